@@ -0,0 +1,63 @@
+// NeoPixelFramePacing
+// This example will move a dot along the strip at a steady frame rate,
+// only rendering a frame when it is due and the strip is ready to show it.
+// Once a second the frame statistics are shown on the serial monitor, 
+// increase the FramesPerSecond or the PixelCount to see the strip send time 
+// limit the rate.
+//
+// This will demonstrate the use of the NeoFrameScheduler class
+//
+
+#include <NeoPixelBus.h>
+
+const uint16_t PixelCount = 144; // make sure to set this to the number of pixels in your strip
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+const uint16_t FramesPerSecond = 100;
+
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+NeoFrameScheduler scheduler(FramesPerSecond);
+
+uint16_t dotPosition = 0;
+uint32_t lastReport = 0;
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    strip.Begin();
+    strip.Show();
+
+    // a frame can not be sent faster than the strip accepts the data
+    scheduler.AddBus<NeoBitsSpeedWs2812x>(strip.PixelsSize());
+
+    Serial.print("Frame period (us): ");
+    Serial.println(scheduler.PeriodUs());
+}
+
+void loop()
+{
+    if (scheduler.Ready(strip))
+    {
+        strip.SetPixelColor(dotPosition, RgbColor(0));
+        dotPosition = (dotPosition + 1) % PixelCount;
+        strip.SetPixelColor(dotPosition, RgbColor(0, 0, 64));
+        strip.Show();
+    }
+
+    if (millis() - lastReport >= 1000)
+    {
+        lastReport = millis();
+
+        Serial.print("shown ");
+        Serial.print(scheduler.FramesShown());
+        Serial.print(", late ");
+        Serial.print(scheduler.FramesLate());
+        Serial.print(", dropped ");
+        Serial.println(scheduler.FramesDropped());
+        scheduler.ResetStats();
+    }
+
+    // other work can be done here, there are 
+    // scheduler.TimeUntilFrameUs(micros()) microseconds until the next frame
+}
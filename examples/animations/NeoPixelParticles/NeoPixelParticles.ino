@@ -0,0 +1,70 @@
+// NeoPixelParticles
+// This example will launch a firework now and then that bursts into sparks
+// which spread along the strip, fall back with gravity and fade out while 
+// leaving short trails.
+//
+// This will demonstrate the use of the NeoParticleSystem class
+//
+
+#include <NeoPixelBus.h>
+
+const uint16_t PixelCount = 144; // make sure to set this to the number of pixels in your strip
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+const uint16_t ParticleCount = 256;
+const uint16_t FrameTime = 16; // ms per frame, the tick of the particles
+
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+NeoParticleSystem<NeoGrbFeature> particles(ParticleCount);
+
+typedef NeoParticleSystem<NeoGrbFeature> Particles;
+
+uint32_t lastFrame = 0;
+
+void burst()
+{
+    int32_t center = random(PixelCount / 4, PixelCount * 3 / 4) * Particles::PixelUnit;
+    RgbColor color = HslColor(random(360) / 360.0f, 1.0f, 0.5f);
+    uint16_t count = random(24, 64);
+
+    for (uint16_t spark = 0; spark < count; spark++)
+    {
+        // speeds up to half a pixel per frame, either direction
+        int32_t velocity = random(-Particles::PixelUnit / 2, Particles::PixelUnit / 2);
+
+        particles.Emit(center, 0, velocity, 0, color, random(40, 90));
+    }
+}
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+
+    // the strip is the x axis, a slight pull toward the start
+    particles.SetGravity(-Particles::PixelUnit / 512, 0);
+    particles.SetBounds(PixelCount);
+
+    randomSeed(analogRead(0));
+}
+
+void loop()
+{
+    if (millis() - lastFrame < FrameTime)
+    {
+        return;
+    }
+    lastFrame = millis();
+
+    if (particles.ActiveCount() == 0 || random(100) == 0)
+    {
+        burst();
+    }
+
+    particles.Update();
+
+    // fade what was drawn last frame to leave trails, then draw the sparks
+    Particles::Decay(strip, 160);
+    particles.Render(strip, NeoParticleBlend_Add);
+
+    strip.Show();
+}
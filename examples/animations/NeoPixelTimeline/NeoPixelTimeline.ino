@@ -0,0 +1,52 @@
+// NeoPixelTimeline
+// This example will fade every pixel through its own keyframed colors while
+// a white dot bounces along the strip, all in a looping timeline.
+// 
+// This will demonstrate the use of the NeoTimeline class, where all tracks
+// are evaluated together each frame without callbacks or floating point
+//
+
+#include <NeoPixelBus.h>
+
+const uint16_t PixelCount = 16; // make sure to set this to the number of pixels in your strip
+const uint16_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+const uint32_t LoopDuration = 4000; // ms
+
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+// for esp8266 omit the pin
+//NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount);
+
+// one color track per pixel and one position track, three keys each
+NeoTimeline<NeoGrbFeature> timeline(PixelCount + 1, (PixelCount + 1) * 3);
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+
+    // each pixel fades from red to blue and back, offset along the strip
+    for (uint16_t pixel = 0; pixel < PixelCount; pixel++)
+    {
+        uint32_t offset = pixel * (LoopDuration / 2) / PixelCount;
+
+        timeline.AddColorTrack(pixel, NeoEase16::SinusoidalInOut);
+        timeline.AddKey(0, RgbColor(32, 0, 0));
+        timeline.AddKey(offset + LoopDuration / 4, RgbColor(0, 0, 32));
+        timeline.AddKey(LoopDuration, RgbColor(32, 0, 0));
+    }
+
+    // a dot that moves from the first pixel to the last and back, positions
+    // are in 1/256 of a pixel
+    timeline.AddPositionTrack(NeoEase16::QuadraticInOut);
+    timeline.AddKey(0, 0, RgbColor(64));
+    timeline.AddKey(LoopDuration / 2, (PixelCount - 1) * 256, RgbColor(64));
+    timeline.AddKey(LoopDuration, 0, RgbColor(64));
+
+    timeline.SetLoopDuration(LoopDuration);
+}
+
+void loop()
+{
+    timeline.Update(strip, millis());
+    strip.Show();
+}
@@ -0,0 +1,68 @@
+// NeoPixelHsbBenchmark
+// This example will measure the time it takes to fill the strip with a rainbow
+// using the floating point HsbColor and then the integer Hsb32Color.
+// The results are shown on the serial monitor, the speed difference is the
+// greatest on platforms without a floating point unit like the Esp8266 and AVR.
+//
+// This will demonstrate the use of the Hsb32Color class and its batch
+// FillHueGradient method
+//
+
+#include <NeoPixelBus.h>
+
+const uint16_t PixelCount = 300; // make sure to set this to the number of pixels in your strip
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+const uint16_t Iterations = 100;
+
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    strip.Begin();
+    strip.Show();
+}
+
+void loop()
+{
+    const uint16_t hueDelta = 65535 / PixelCount;
+    uint32_t start;
+
+    // the float path, one conversion per pixel
+    start = micros();
+    for (uint16_t iteration = 0; iteration < Iterations; iteration++)
+    {
+        for (uint16_t index = 0; index < PixelCount; index++)
+        {
+            float hue = (iteration + index * hueDelta) / 65536.0f;
+            strip.SetPixelColor(index, HsbColor(hue, 1.0f, 0.25f));
+        }
+    }
+    uint32_t floatTime = micros() - start;
+    strip.Show();
+
+    // the integer batch path
+    start = micros();
+    for (uint16_t iteration = 0; iteration < Iterations; iteration++)
+    {
+        NeoBufferContext<NeoGrbFeature> pixels = strip;
+
+        Hsb32Color::FillHueGradient<NeoGrbFeature>(pixels.Pixels,
+            0,
+            pixels.PixelCount(),
+            Hsb32Color(iteration, 255, 64),
+            hueDelta);
+    }
+    uint32_t integerTime = micros() - start;
+    strip.Show();
+
+    Serial.print("HsbColor per frame (us): ");
+    Serial.println(floatTime / Iterations);
+    Serial.print("Hsb32Color per frame (us): ");
+    Serial.println(integerTime / Iterations);
+    Serial.println();
+
+    delay(2000);
+}
@@ -0,0 +1,48 @@
+// NeoPixelPaletteBuffer
+// This example will draw a rainbow once into a palette buffer and then
+// animate it by only rotating the palette.
+//
+// This will demonstrate the use of the NeoBufferPaletteMethod, each pixel 
+// in the buffer only uses 4 bits and the palette is expanded into the 
+// feature format when the buffer is Blt to the strip.
+//
+
+#include <NeoPixelBus.h>
+
+const uint16_t PixelCount = 64; // make sure to set this to the number of pixels in your strip
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+const uint8_t PaletteCount = 16;
+
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+
+// 64 pixels using 32 bytes plus the palette of 16 colors
+NeoBuffer<NeoBufferPaletteMethod<NeoGrbFeature, PaletteCount>> image(PixelCount, 1);
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+
+    // a rainbow palette
+    for (uint8_t index = 0; index < PaletteCount; index++)
+    {
+        float hue = index / static_cast<float>(PaletteCount);
+        image.SetPaletteColor(index, HslColor(hue, 1.0f, 0.1f));
+    }
+
+    // spread the palette across the pixels, this is only done once
+    for (uint16_t x = 0; x < PixelCount; x++)
+    {
+        image.SetPixelIndex(x, 0, x * PaletteCount / PixelCount);
+    }
+}
+
+void loop()
+{
+    // moving the rainbow only costs a rotation of the 16 palette entries
+    image.RotatePaletteLeft(1);
+    image.Blt(strip, 0);
+    strip.Show();
+
+    delay(50);
+}
@@ -0,0 +1,56 @@
+// NeoPixelScrollingText
+// This example will scroll a message across a matrix panel, moving a 
+// fraction of a pixel each frame so the motion stays smooth at slow speeds.
+// The text is rasterized once, each frame only copies the visible window.
+//
+// This will demonstrate the use of the NeoTextStrip class
+//
+
+#include <NeoPixelBus.h>
+
+const uint8_t PanelWidth = 32;  // 32 pixel x 8 pixel matrix of leds
+const uint8_t PanelHeight = 8;
+const uint16_t PixelCount = PanelWidth * PanelHeight;
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+const int32_t Speed = 96; // in 1/256 of a column per frame
+
+NeoTopology<ColumnMajorAlternatingLayout> topo(PanelWidth, PanelHeight);
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+NeoBuffer<NeoBufferMethod<NeoGrbFeature>> image(PanelWidth, PanelHeight, nullptr);
+NeoTextStrip<> text;
+
+typedef NeoTextStrip<> TextStrip;
+
+int32_t position;
+
+uint16_t LayoutMap(int16_t x, int16_t y)
+{
+    return topo.MapProbe(x, y);
+}
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+
+    text.SetText("NeoPixelBus scrolling text");
+
+    // start with the text just off the right side
+    position = -PanelWidth * TextStrip::ColumnUnit;
+}
+
+void loop()
+{
+    // the 7 pixel high font leaves the bottom row for the background
+    text.Render(image, position, RgbColor(0, 48, 32), RgbColor(0));
+    image.Blt(strip, 0, 0, LayoutMap);
+    strip.Show();
+
+    position += Speed;
+    if (position >= text.ColumnCount() * TextStrip::ColumnUnit)
+    {
+        position = -PanelWidth * TextStrip::ColumnUnit;
+    }
+
+    delay(16);
+}
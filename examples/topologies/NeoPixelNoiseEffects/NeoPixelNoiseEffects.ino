@@ -0,0 +1,51 @@
+// NeoPixelNoiseEffects
+// This example will show fire, plasma and drifting clouds on a matrix panel, 
+// changing the effect every ten seconds.
+// All of the effects are computed with integer noise, so they run smoothly
+// even on platforms without a floating point unit like the Esp8266.
+//
+// This will demonstrate the use of the NeoNoiseEffects class
+//
+
+#include <NeoPixelBus.h>
+
+const uint8_t PanelWidth = 16;  // 16 pixel x 16 pixel matrix of leds
+const uint8_t PanelHeight = 16;
+const uint16_t PixelCount = PanelWidth * PanelHeight;
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+
+NeoTopology<ColumnMajorAlternatingLayout> topo(PanelWidth, PanelHeight);
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+NeoNoiseEffects<NeoGrbFeature> effects(PanelWidth);
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+}
+
+void loop()
+{
+    // the noise field moves a cell every two seconds
+    uint32_t time = millis() * 32;
+
+    switch ((millis() / 10000) % 3)
+    {
+    case 0:
+        effects.SetScale(0x1800);
+        effects.Fire(strip, topo, time);
+        break;
+
+    case 1:
+        effects.SetScale(0x2000);
+        effects.Plasma(strip, topo, time, 64);
+        break;
+
+    default:
+        effects.SetScale(0x1000);
+        effects.Blend(strip, topo, time, RgbColor(0, 0, 48), RgbColor(96), true);
+        break;
+    }
+
+    strip.Show();
+}
@@ -0,0 +1,58 @@
+// NeoPixelPointTopology
+// This example will draw a moving rainbow into a small 2d image and show it
+// on pixels placed at arbitrary points, like the outline of a star, then 
+// light the pixel nearest to a point that circles the middle.
+//
+// This will demonstrate the use of the NeoPointTopology class
+//
+
+#include <NeoPixelBus.h>
+
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+
+// the x, y of each pixel in strip order, in any units, here millimeters
+const int16_t PixelPoints[] PROGMEM = {
+    0, 95,    22, 31,   90, 31,   36, -12,  56, -77,
+    0, -38,   -56, -77, -36, -12, -90, 31,  -22, 31
+};
+const uint16_t PixelCount = sizeof(PixelPoints) / (2 * sizeof(int16_t));
+
+const uint8_t ImageWidth = 16;
+const uint8_t ImageHeight = 16;
+
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+NeoBuffer<NeoBufferMethod<NeoGrbFeature>> image(ImageWidth, ImageHeight, nullptr);
+NeoPointTopology points;
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+
+    points.LoadProgmem(PixelPoints, PixelCount);
+    points.BuildSampleTable(ImageWidth, ImageHeight);
+}
+
+void loop()
+{
+    uint16_t hueStart = millis() * 16;
+
+    // draw the effect in 2d, here diagonal bands of hue
+    for (uint8_t y = 0; y < ImageHeight; y++)
+    {
+        for (uint8_t x = 0; x < ImageWidth; x++)
+        {
+            image.SetPixelColor(x, y, Hsb32Color(hueStart + (x + y) * 2048, 255, 32));
+        }
+    }
+
+    // show the image on the points
+    points.Render(strip, image);
+
+    // and highlight the one nearest to a point circling the middle
+    float angle = millis() / 1000.0f;
+    uint16_t nearest = points.Nearest(cos(angle) * 60, sin(angle) * 60);
+
+    strip.SetPixelColor(nearest, RgbColor(96));
+    strip.Show();
+}
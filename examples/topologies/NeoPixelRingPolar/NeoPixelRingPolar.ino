@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------
+// NeoPixelRingPolar
+// This will spin a color wheel around a series of rings and send a pulse
+// out from the center, using the precomputed angle of every pixel rather 
+// than any trig in the loop.
+//
+// This will demonstrate the use of the NeoRingPolar class
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+
+const uint8_t PixelCount = 119;
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+
+// the same layout as the NeoPixelRingTopologyTest example
+class MyRingsLayout
+{
+protected:
+    const uint16_t Rings[7] = {0, 1, 7, 19, 35, 59, PixelCount}; 
+    
+    uint8_t _ringCount() const
+    {
+        return sizeof(Rings) / sizeof(Rings[0]);
+    }
+};
+
+typedef NeoRingTopology<MyRingsLayout> MyRings;
+
+// the radius of each ring in millimeters
+const uint16_t RingRadii[6] = {0, 8, 16, 22, 32, 48};
+
+MyRings topo;
+NeoRingPolar<MyRings> polar(topo, RingRadii);
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+NeoBuffer<NeoBufferMethod<NeoGrbFeature>> wheel(3, 1, nullptr);
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+
+    // the wheel gradient blends red to green to blue and back to red
+    wheel.SetPixelColor(0, 0, RgbColor(32, 0, 0));
+    wheel.SetPixelColor(1, 0, RgbColor(0, 32, 0));
+    wheel.SetPixelColor(2, 0, RgbColor(0, 0, 32));
+}
+
+void loop()
+{
+    uint16_t rotate = millis() * 32;
+    uint16_t pulseRadius = millis() * 40;
+
+    polar.RenderGradient(strip, wheel, NeoRingGradient_Angular, rotate);
+
+    // the pulse lights the pixels of the ring nearest to its radius
+    for (uint8_t ring = 0; ring < topo.getCountOfRings(); ring++)
+    {
+        uint16_t radius = polar.GetRadius(ring);
+        uint16_t delta = (radius > pulseRadius) ? radius - pulseRadius : pulseRadius - radius;
+
+        if (delta < 4096)
+        {
+            for (uint16_t pixel = 0; pixel < topo.getPixelCountAtRing(ring); pixel++)
+            {
+                strip.SetPixelColor(topo.Map(ring, pixel), RgbColor(64));
+            }
+        }
+    }
+
+    strip.Show();
+}
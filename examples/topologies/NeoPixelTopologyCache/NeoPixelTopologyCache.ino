@@ -0,0 +1,43 @@
+// NeoPixelTopologyCache
+// This example will draw a moving diagonal rainbow across tiled matrix 
+// panels, walking the pixels in strip order and using the cached inverse
+// map to find where each one is.
+//
+// This will demonstrate the use of the NeoTopologyCache class
+//
+
+#include <NeoPixelBus.h>
+
+const uint8_t PanelWidth = 8;  // 8 pixel x 8 pixel matrix of leds
+const uint8_t PanelHeight = 8;
+const uint8_t TileWidth = 4;  // laid out in 4 panels x 2 panels mosaic
+const uint8_t TileHeight = 2;
+const uint16_t PixelCount = PanelWidth * PanelHeight * TileWidth * TileHeight;
+const uint8_t PixelPin = 2;  // make sure to set this to the correct pin, ignored for Esp8266
+
+typedef NeoTiles<ColumnMajorAlternatingLayout, RowMajorAlternatingLayout> MyTiles;
+
+NeoPixelBus<NeoGrbFeature, NeoWs2812xMethod> strip(PixelCount, PixelPin);
+MyTiles tiles(PanelWidth, PanelHeight, TileWidth, TileHeight);
+NeoTopologyCache<MyTiles> cache(tiles);
+
+void setup()
+{
+    strip.Begin();
+    strip.Show();
+}
+
+void loop()
+{
+    uint16_t hueStart = millis() * 16;
+
+    for (uint16_t indexPixel = 0; indexPixel < PixelCount; indexPixel++)
+    {
+        int16_t x;
+        int16_t y;
+
+        cache.Unmap(indexPixel, &x, &y);
+        strip.SetPixelColor(indexPixel, Hsb32Color(hueStart + (x + y) * 1024, 255, 48));
+    }
+    strip.Show();
+}
@@ -0,0 +1,245 @@
+/*-------------------------------------------------------------------------
+HtmlColorNamesCheck - host check of the hand written lookup tables in
+HtmlColorNames.cpp and HtmlColorShortNames.cpp, that also prints the tables
+regenerated from the pair tables
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+// This is not part of the library build, compile it on the host with
+//      c++ -std=c++11 -O2 -Istub -o HtmlColorNamesCheck HtmlColorNamesCheck.cpp
+// and run it, it returns non zero and prints the failures if any check fails.
+// When a name is added to or removed from a pair table, run it to get the
+// regenerated ByLength, LengthStarts and ByColor tables to paste into the
+// source file, they are printed for any table that doesn't match.
+//
+
+#include <Arduino.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+// the sources are included so their static tables can be checked
+#include "../../../src/internal/colors/HtmlColorNameStrings.cpp"
+#include "../../../src/internal/colors/HtmlColor.cpp"
+#include "../../../src/internal/colors/HtmlColorNames.cpp"
+#include "../../../src/internal/colors/HtmlColorShortNames.cpp"
+
+static int s_failures = 0;
+
+static void check(bool passed, const char* name, const char* what)
+{
+    if (!passed)
+    {
+        printf("FAILED %s: %s\n", name, what);
+        s_failures++;
+    }
+}
+
+// only provides Pair and Count, so Parse and ToString use the linear scan
+class LinearColorNames
+{
+public:
+    static const HtmlColorPair* Pair(uint8_t index)
+    {
+        return HtmlColorNames::Pair(index);
+    }
+
+    static uint8_t Count()
+    {
+        return HtmlColorNames::Count();
+    }
+};
+
+struct NameTable
+{
+    const char* Name;
+    const HtmlColorPair* Pairs;
+    size_t Count;
+    const uint8_t* ByLength;
+    size_t ByLengthCount;
+    const uint8_t* LengthStarts;
+    const uint8_t* ByColor;
+    size_t ByColorCount;
+};
+
+static void printTable(const char* name, const char* size, const std::vector<uint8_t>& values)
+{
+    printf("static const uint8_t %s[%s] PROGMEM = {", name, size);
+    for (size_t index = 0; index < values.size(); index++)
+    {
+        printf("%s%u,", (index % 16) ? " " : "\n    ", values[index]);
+    }
+    printf("\n};\n\n");
+}
+
+static void checkTable(const NameTable& table)
+{
+    std::vector<uint8_t> byLength;
+    std::vector<uint8_t> lengthStarts;
+    std::vector<uint8_t> byColor;
+
+    check(table.Count <= 0xff, table.Name, "more pairs than a uint8_t index");
+
+    for (size_t index = 0; index < table.Count; index++)
+    {
+        std::string pairName(table.Pairs[index].Name);
+
+        check(pairName.size() > 0 && pairName.size() <= MAX_HTML_COLOR_NAME_LEN, table.Name, "name length");
+        for (char ch : pairName)
+        {
+            check(isalnum(ch) && ch == tolower(ch), table.Name, "name isn't lower case alpha numeric");
+        }
+        byLength.push_back(index);
+        byColor.push_back(index);
+    }
+
+    // regenerate the tables the way HtmlColorPairIndex documents them
+    std::stable_sort(byLength.begin(), byLength.end(), [&](uint8_t left, uint8_t right)
+        {
+            std::string leftName(table.Pairs[left].Name);
+            std::string rightName(table.Pairs[right].Name);
+
+            if (leftName.size() != rightName.size())
+            {
+                return leftName.size() < rightName.size();
+            }
+            return leftName < rightName;
+        });
+    std::stable_sort(byColor.begin(), byColor.end(), [&](uint8_t left, uint8_t right)
+        {
+            return table.Pairs[left].Color < table.Pairs[right].Color;
+        });
+
+    for (size_t length = 0; length <= MAX_HTML_COLOR_NAME_LEN + 1; length++)
+    {
+        size_t start = 0;
+
+        while (start < byLength.size() && strlen(table.Pairs[byLength[start]].Name) < length)
+        {
+            start++;
+        }
+        lengthStarts.push_back(start);
+    }
+
+    bool matches = (byLength.size() == table.ByLengthCount) &&
+        std::equal(byLength.begin(), byLength.end(), table.ByLength) &&
+        std::equal(lengthStarts.begin(), lengthStarts.end(), table.LengthStarts) &&
+        (byColor.size() == table.ByColorCount) &&
+        std::equal(byColor.begin(), byColor.end(), table.ByColor);
+
+    check(matches, table.Name, "lookup tables don't match the pair table, regenerated:");
+    if (!matches)
+    {
+        std::string prefix(table.Name);
+
+        printTable((prefix + "ByLength").c_str(), "", byLength);
+        printTable((prefix + "LengthStarts").c_str(), "MAX_HTML_COLOR_NAME_LEN + 2", lengthStarts);
+        printTable((prefix + "ByColor").c_str(), "", byColor);
+    }
+}
+
+// Parse and ToString through T_NAMES must give what a scan of the pair
+// table gives, the first pair for a color and names in any case
+template <typename T_NAMES> static void checkLookup(const char* name)
+{
+    char buf[MAX_HTML_COLOR_NAME_LEN + 1];
+
+    for (uint8_t index = 0; index < T_NAMES::Count(); index++)
+    {
+        const HtmlColorPair* pair = T_NAMES::Pair(index);
+        std::string pairName(pair->Name);
+        HtmlColor color;
+
+        // upper cased and followed by a delimiter
+        std::string parseName(pairName);
+
+        std::transform(parseName.begin(), parseName.end(), parseName.begin(), ::toupper);
+        parseName += ", ";
+
+        check(color.Parse<T_NAMES>(parseName.c_str(), parseName.size() + 1) == pairName.size(),
+            name, "parse length");
+        check(color.Color == pair->Color, name, "parse color");
+
+        // a longer name is not a match
+        check(color.Parse<T_NAMES>((pairName + "x").c_str()) == 0, name, "parse of a longer name");
+
+        // the first pair with the color is the name given
+        uint8_t first = 0;
+
+        while (T_NAMES::Pair(first)->Color != pair->Color)
+        {
+            first++;
+        }
+        HtmlColor(pair->Color).ToString<T_NAMES>(buf, sizeof(buf));
+        check(strcmp(buf, T_NAMES::Pair(first)->Name) == 0, name, "to string of a named color");
+    }
+
+    HtmlColor color;
+
+    check(color.Parse<T_NAMES>("notacolor") == 0, name, "parse of an unknown name");
+    check(color.Parse<T_NAMES>("") == 0, name, "parse of an empty name");
+    HtmlColor(0x123456).ToString<T_NAMES>(buf, sizeof(buf));
+    check(strcmp(buf, "#123456") == 0, name, "to string of an unnamed color");
+}
+
+int main()
+{
+    const NameTable tables[] = {
+        {
+            "c_ColorNames",
+            c_ColorNames,
+            countof(c_ColorNames),
+            c_ColorNamesByLength,
+            countof(c_ColorNamesByLength),
+            c_ColorNamesLengthStarts,
+            c_ColorNamesByColor,
+            countof(c_ColorNamesByColor)
+        },
+        {
+            "c_ShortColorNames",
+            c_ShortColorNames,
+            countof(c_ShortColorNames),
+            c_ShortColorNamesByLength,
+            countof(c_ShortColorNamesByLength),
+            c_ShortColorNamesLengthStarts,
+            c_ShortColorNamesByColor,
+            countof(c_ShortColorNamesByColor)
+        },
+    };
+
+    for (const NameTable& table : tables)
+    {
+        checkTable(table);
+    }
+
+    checkLookup<HtmlColorNames>("HtmlColorNames");
+    checkLookup<HtmlShortColorNames>("HtmlShortColorNames");
+    checkLookup<LinearColorNames>("LinearColorNames");
+
+    if (s_failures == 0)
+    {
+        printf("all checks passed\n");
+    }
+    return s_failures;
+}
@@ -0,0 +1,43 @@
+// host stand in for Arduino.h, only what the HtmlColor sources use
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PGM_VOID_P const void*
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t*>(addr))
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t*>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t*>(addr))
+#define pgm_read_ptr(addr) (*reinterpret_cast<const void* const *>(addr))
+#define strncpy_P strncpy
+#define strlen_P strlen
+
+class String
+{
+public:
+    const char* c_str() const
+    {
+        return "";
+    }
+
+    size_t length() const
+    {
+        return 0;
+    }
+};
+
+// NeoUtil::PrintBin needs it to compile, the check doesn't call it
+struct HardwareSerial
+{
+    size_t print(const char* text)
+    {
+        return printf("%s", text);
+    }
+};
+
+static HardwareSerial Serial;
@@ -0,0 +1,218 @@
+/*-------------------------------------------------------------------------
+NeoEsp32LcdStreamCheck - host check of the NeoEsp32LcdXMethod contexts that
+runs them against a simulated LCD DMA and compares what is sent to the
+expected 3 step cadence encoding of the pixel data
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+// This is not part of the library build, compile it on the host with
+//      c++ -std=c++17 -O2 -Istub -o NeoEsp32LcdStreamCheck NeoEsp32LcdStreamCheck.cpp
+// and run it, it returns non zero and prints the failures if any check fails.
+// The stub folder stands in for the Arduino and ESP-IDF headers, its
+// simulated DMA reads the descriptors the way the LCD peripheral does and
+// can call the EOF ISR late to check the underrun detection.
+//
+
+#include <Arduino.h>
+#include <memory>
+#include <initializer_list>
+
+#define ARDUINO_ARCH_ESP32
+#define CONFIG_IDF_TARGET_ESP32S3
+
+#include "../../../src/internal/NeoSettings.h"
+#include "../../../src/internal/methods/NeoBits.h"
+#include "../../../src/internal/methods/NeoEsp32LcdXMethod.h"
+
+// the clock divider isn't part of the check
+extern "C" void UnitDecimalToFractionClks(uint8_t* resultN,
+    uint8_t* resultD,
+    double unitDecimal,
+    double accuracy)
+{
+    *resultN = 0;
+    *resultD = 1;
+}
+
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2812x, NeoEsp32LcdMux8Bus, NeoBitsNotInverted> MonoMethod8;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2812x, NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> StreamMethod8;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2812x, NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> StreamMethod16;
+
+static int s_failures = 0;
+
+static void check(bool passed, const char* name, const char* what)
+{
+    if (!passed)
+    {
+        printf("FAILED %s: %s\n", name, what);
+        s_failures++;
+    }
+}
+
+// the expected output, each pixel bit is 3 steps of 1, the bit, 0
+// and each step is muxBusDataSize bytes with a bit per mux bus
+static std::vector<uint8_t> encodeReference(const std::vector<std::vector<uint8_t>>& lanes,
+    size_t maxBusDataSize,
+    size_t muxBusDataSize)
+{
+    std::vector<uint8_t> result(maxBusDataSize * 8 * 3 * muxBusDataSize, 0);
+
+    for (size_t muxId = 0; muxId < lanes.size(); muxId++)
+    {
+        const std::vector<uint8_t>& lane = lanes[muxId];
+
+        for (size_t index = 0; index < lane.size(); index++)
+        {
+            for (size_t bit = 0; bit < 8; bit++)
+            {
+                size_t step = (index * 8 + bit) * 3;
+                bool value = (lane[index] << bit) & 0x80;
+
+                result[step * muxBusDataSize + muxId / 8] |= 1 << (muxId % 8);
+                if (value)
+                {
+                    result[(step + 1) * muxBusDataSize + muxId / 8] |= 1 << (muxId % 8);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template<typename T_METHOD, typename T_BUS, size_t V_MUX_BUS_DATA_SIZE, bool V_STREAM>
+static void checkFrames(const char* name,
+    std::initializer_list<uint16_t> pixelCounts,
+    size_t isrDelay,
+    bool expectUnderrun)
+{
+    const size_t numResetBytes = NeoBitsSpeedWs2812x::ResetTimeUs /
+        NeoBitsSpeedWs2812x::ByteSendTimeUs(NeoBitsSpeedWs2812x::BitSendTimeNs);
+    std::vector<std::unique_ptr<T_METHOD>> methods;
+    size_t maxBusDataSize = 0;
+    uint32_t underrunsBefore = 0;
+    bool underrun = false;
+
+    for (uint16_t pixelCount : pixelCounts)
+    {
+        methods.emplace_back(new T_METHOD(methods.size(), pixelCount, 3, 0));
+        if (pixelCount * 3 + numResetBytes > maxBusDataSize)
+        {
+            maxBusDataSize = pixelCount * 3 + numResetBytes;
+        }
+    }
+    for (auto& method : methods)
+    {
+        check(method->Initialize(), name, "Initialize");
+    }
+
+    if constexpr (V_STREAM)
+    {
+        underrunsBefore = T_BUS::UnderrunCount();
+    }
+
+    // several frames so the ring is primed again with new data each time
+    for (int frame = 0; frame < 3; frame++)
+    {
+        std::vector<std::vector<uint8_t>> lanes;
+
+        for (auto& method : methods)
+        {
+            uint8_t* data = method->getData();
+
+            for (size_t index = 0; index < method->getDataSize(); index++)
+            {
+                data[index] = rand();
+            }
+            lanes.emplace_back(data, data + method->getDataSize());
+            method->Update(false);
+        }
+
+        std::vector<uint8_t> output = NeoEsp32LcdStubDma::Run(isrDelay);
+        std::vector<uint8_t> expected = encodeReference(lanes, maxBusDataSize, V_MUX_BUS_DATA_SIZE);
+
+        check(LCD_CAM.lcd_user.lcd_start == 0, name, "frame did not complete");
+        for (auto& method : methods)
+        {
+            check(method->IsReadyToUpdate(), name, "not ready after the frame");
+        }
+
+        if (expectUnderrun)
+        {
+            continue;
+        }
+
+        // the mono context uses the last pixel byte of reset time for the EOF
+        check(output.size() + 8 * 3 * V_MUX_BUS_DATA_SIZE >= expected.size(), name, "output too short");
+
+        bool matches = true;
+        bool tailZero = true;
+
+        for (size_t index = 0; index < output.size(); index++)
+        {
+            if (index < expected.size())
+            {
+                matches = matches && (output[index] == expected[index]);
+            }
+            else
+            {
+                tailZero = tailZero && (output[index] == 0);
+            }
+        }
+        check(matches, name, "output doesn't match the reference encoding");
+        check(tailZero, name, "output after the frame isn't zero");
+    }
+
+    if constexpr (V_STREAM)
+    {
+        underrun = (T_BUS::UnderrunCount() != underrunsBefore);
+    }
+    check(underrun == expectUnderrun, name, expectUnderrun ? "underrun not detected" : "unexpected underrun");
+}
+
+int main()
+{
+    // the reference encoding is checked against the existing whole frame context
+    checkFrames<MonoMethod8, NeoEsp32LcdMux8Bus, 1, false>("mono 8", { 100, 37, 64 }, 0, false);
+
+    // on time and late by less than the ring, where EOFs get combined
+    checkFrames<StreamMethod8, NeoEsp32LcdMux8StreamBus, 1, true>("stream 8", { 100, 37, 64 }, 0, false);
+    checkFrames<StreamMethod8, NeoEsp32LcdMux8StreamBus, 1, true>("stream 8 short", { 3 }, 0, false);
+    checkFrames<StreamMethod8, NeoEsp32LcdMux8StreamBus, 1, true>("stream 8 late", { 100, 37, 64 }, 2, false);
+    checkFrames<StreamMethod16, NeoEsp32LcdMux16StreamBus, 2, true>("stream 16",
+        { 300, 1, 299, 150, 64, 7, 11, 12, 13, 200 }, 0, false);
+    checkFrames<StreamMethod16, NeoEsp32LcdMux16StreamBus, 2, true>("stream 16 late",
+        { 300, 1, 299, 150, 64, 7, 11, 12, 13, 200 }, 1, false);
+
+    // late enough that the DMA reached a chunk that wasn't encoded yet
+    checkFrames<StreamMethod8, NeoEsp32LcdMux8StreamBus, 1, true>("stream 8 underrun", { 100, 37, 64 }, 3, true);
+
+    // and recovers on the next frames
+    checkFrames<StreamMethod8, NeoEsp32LcdMux8StreamBus, 1, true>("stream 8 after underrun", { 50 }, 0, false);
+
+    if (s_failures == 0)
+    {
+        printf("all checks passed\n");
+    }
+    return s_failures;
+}
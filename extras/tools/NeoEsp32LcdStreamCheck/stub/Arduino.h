@@ -0,0 +1,2 @@
+// host stand in for Arduino.h, see NeoEsp32LcdStub.h
+#include "NeoEsp32LcdStub.h"
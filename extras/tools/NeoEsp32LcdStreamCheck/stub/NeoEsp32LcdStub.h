@@ -0,0 +1,331 @@
+/*-------------------------------------------------------------------------
+NeoEsp32LcdStub - host stand ins for the Arduino and ESP-IDF parts used by
+NeoEsp32LcdXMethod.h, with a simulated LCD DMA so NeoEsp32LcdStreamCheck
+can run the contexts on the host
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <vector>
+
+// Arduino
+//
+#define IRAM_ATTR
+#define INPUT 0x01
+#define log_e(...) NeoEsp32LcdStubLog("[E] ", __VA_ARGS__)
+#define log_w(...) NeoEsp32LcdStubLog("[W] ", __VA_ARGS__)
+
+// not checked as a printf format, size_t is 32 bits on the Esp32
+inline void NeoEsp32LcdStubLog(const char* level, const char* format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    printf("%s", level);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+}
+
+inline void yield()
+{
+}
+
+inline void pinMode(uint8_t, uint8_t)
+{
+}
+
+// heap
+//
+#define MALLOC_CAP_DMA 0x08
+#define MALLOC_CAP_8BIT 0x04
+#define MALLOC_CAP_INTERNAL 0x800
+
+inline void* heap_caps_malloc(size_t size, uint32_t)
+{
+    return malloc(size);
+}
+
+inline void heap_caps_free(void* ptr)
+{
+    free(ptr);
+}
+
+// rom, periph, gpio
+//
+#define PERIPH_LCD_CAM_MODULE 0
+#define LCD_LL_CLK_FRAC_DIV_N_MAX 256
+#define LCD_DATA_OUT0_IDX 133
+#define SIG_GPIO_OUT_IDX 256
+#define PIN_FUNC_GPIO 2
+
+typedef int gpio_num_t;
+typedef int gpio_drive_cap_t;
+
+static const uint32_t GPIO_PIN_MUX_REG[49] = { 0 };
+
+inline void esp_rom_delay_us(uint32_t)
+{
+}
+
+inline void periph_module_enable(int)
+{
+}
+
+inline void periph_module_reset(int)
+{
+}
+
+inline void periph_module_disable(int)
+{
+}
+
+inline void esp_rom_gpio_connect_out_signal(uint32_t, uint32_t, bool, bool)
+{
+}
+
+inline void gpio_hal_iomux_func_sel(uint32_t, uint32_t)
+{
+}
+
+inline void gpio_set_drive_capability(gpio_num_t, gpio_drive_cap_t)
+{
+}
+
+inline void gpio_matrix_out(uint32_t, uint32_t, bool, bool)
+{
+}
+
+// dma descriptors
+//
+#define DMA_DESCRIPTOR_BUFFER_OWNER_DMA 1
+#define DMA_DESCRIPTOR_BUFFER_MAX_SIZE 4095
+
+struct dma_descriptor_t
+{
+    struct
+    {
+        uint32_t size : 12;
+        uint32_t length : 12;
+        uint32_t reserved24 : 4;
+        uint32_t err_eof : 1;
+        uint32_t reserved29 : 1;
+        uint32_t suc_eof : 1;
+        uint32_t owner : 1;
+    } dw0;
+    void* buffer;
+    dma_descriptor_t* next;
+};
+
+// lcd registers, only the fields used
+//
+struct NeoEsp32LcdStubRegisters
+{
+    struct
+    {
+        uint32_t lcd_start;
+        uint32_t lcd_reset;
+        uint32_t lcd_dout;
+        uint32_t lcd_update;
+        uint32_t lcd_always_out_en;
+        uint32_t lcd_8bits_order;
+        uint32_t lcd_bit_order;
+        uint32_t lcd_2byte_en;
+        uint32_t lcd_dummy;
+        uint32_t lcd_dummy_cyclelen;
+        uint32_t lcd_cmd;
+    } lcd_user;
+    struct
+    {
+        uint32_t clk_en;
+        uint32_t lcd_clk_sel;
+        uint32_t lcd_clkm_div_a;
+        uint32_t lcd_clkm_div_b;
+        uint32_t lcd_clkm_div_num;
+        uint32_t lcd_ck_out_edge;
+        uint32_t lcd_ck_idle_edge;
+        uint32_t lcd_clk_equ_sysclk;
+    } lcd_clock;
+    struct
+    {
+        uint32_t lcd_rgb_mode_en;
+    } lcd_ctrl;
+    struct
+    {
+        uint32_t lcd_conv_bypass;
+    } lcd_rgb_yuv;
+    struct
+    {
+        uint32_t lcd_next_frame_en;
+        uint32_t lcd_afifo_reset;
+    } lcd_misc;
+    struct
+    {
+        uint32_t val;
+    } lcd_data_dout_mode;
+};
+
+inline NeoEsp32LcdStubRegisters LCD_CAM;
+
+// gdma
+//
+#define GDMA_CHANNEL_DIRECTION_TX 1
+#define GDMA_TRIG_PERIPH_LCD 5
+#define GDMA_MAKE_TRIGGER(peri, id) (peri)
+
+struct gdma_channel_t
+{
+    int unused;
+};
+typedef gdma_channel_t* gdma_channel_handle_t;
+
+typedef struct
+{
+    union
+    {
+        intptr_t rx_eof_desc_addr;
+        intptr_t tx_eof_desc_addr;
+    };
+} gdma_event_data_t;
+
+typedef bool (*gdma_event_callback_t)(gdma_channel_handle_t dma_chan, gdma_event_data_t* event_data, void* user_data);
+
+typedef struct
+{
+    gdma_event_callback_t on_trans_eof;
+} gdma_tx_event_callbacks_t;
+
+typedef struct
+{
+    gdma_channel_handle_t sibling_chan;
+    int direction;
+    struct
+    {
+        uint32_t reserve_sibling : 1;
+    } flags;
+} gdma_channel_alloc_config_t;
+
+typedef struct
+{
+    bool owner_check;
+    bool auto_update_desc;
+} gdma_strategy_config_t;
+
+// the simulated DMA, Run() feeds the descriptors started by gdma_start to
+// the LCD until the EOF callback clears lcd_start
+//
+class NeoEsp32LcdStubDma
+{
+public:
+    static inline gdma_channel_t Channel;
+    static inline gdma_event_callback_t Callback;
+    static inline void* UserData;
+    static inline dma_descriptor_t* Start;
+
+    // isrDelay - the count of descriptors the DMA reads after an EOF before
+    //      its ISR is called, the EOFs in between are combined into that call
+    //      like the level triggered interrupt does
+    static std::vector<uint8_t> Run(size_t isrDelay)
+    {
+        std::vector<uint8_t> output;
+        dma_descriptor_t* item = Start;
+        dma_descriptor_t* itemEof = nullptr;
+        size_t sinceEof = 0;
+        size_t guard = 0;
+
+        while (LCD_CAM.lcd_user.lcd_start && guard++ < 1000000)
+        {
+            if (item != nullptr)
+            {
+                const uint8_t* buffer = static_cast<const uint8_t*>(item->buffer);
+
+                output.insert(output.end(), buffer, buffer + item->dw0.length);
+                if (item->dw0.suc_eof)
+                {
+                    if (itemEof == nullptr)
+                    {
+                        sinceEof = 0;
+                    }
+                    itemEof = item;
+                }
+                item = item->next;
+            }
+
+            if (itemEof != nullptr && (sinceEof++ >= isrDelay || item == nullptr))
+            {
+                gdma_event_data_t event;
+
+                event.tx_eof_desc_addr = reinterpret_cast<intptr_t>(itemEof);
+                itemEof = nullptr;
+                Callback(&Channel, &event, UserData);
+            }
+            else if (item == nullptr && itemEof == nullptr)
+            {
+                // out of descriptors without an EOF, the LCD would hang
+                break;
+            }
+        }
+        return output;
+    }
+};
+
+inline int gdma_new_channel(const gdma_channel_alloc_config_t*, gdma_channel_handle_t* channel)
+{
+    *channel = &NeoEsp32LcdStubDma::Channel;
+    return 0;
+}
+
+inline int gdma_connect(gdma_channel_handle_t, int)
+{
+    return 0;
+}
+
+inline int gdma_apply_strategy(gdma_channel_handle_t, const gdma_strategy_config_t*)
+{
+    return 0;
+}
+
+inline int gdma_register_tx_event_callbacks(gdma_channel_handle_t, gdma_tx_event_callbacks_t* callbacks, void* userData)
+{
+    NeoEsp32LcdStubDma::Callback = callbacks->on_trans_eof;
+    NeoEsp32LcdStubDma::UserData = userData;
+    return 0;
+}
+
+inline int gdma_reset(gdma_channel_handle_t)
+{
+    return 0;
+}
+
+inline int gdma_start(gdma_channel_handle_t, intptr_t descriptor)
+{
+    NeoEsp32LcdStubDma::Start = reinterpret_cast<dma_descriptor_t*>(descriptor);
+    return 0;
+}
@@ -0,0 +1,2 @@
+// host stand in for the ESP-IDF header, see NeoEsp32LcdStub.h
+#include "NeoEsp32LcdStub.h"
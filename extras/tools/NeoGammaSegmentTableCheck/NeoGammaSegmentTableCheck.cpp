@@ -0,0 +1,143 @@
+/*-------------------------------------------------------------------------
+NeoGammaSegmentTableCheck - host check of NeoGammaSegmentTableMethod that
+measures its error against the exact equation of each provided curve
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+// This is not part of the library build, compile it on the host with
+//      c++ -std=c++11 -O2 -o NeoGammaSegmentTableCheck NeoGammaSegmentTableCheck.cpp
+// and run it, it prints the measured errors and returns non zero if any
+// is over the max error documented in NeoGammaSegmentTableMethod.h
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+
+#define PROGMEM
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t*>(addr))
+
+#include "../../../src/internal/colors/NeoGammaCurves.h"
+#include "../../../src/internal/colors/NeoGammaSegmentTableMethod.h"
+
+// the exact equations, using the runtime math library rather than the
+// constexpr math of the curves
+static double exactPower26(double unitValue)
+{
+    return pow(unitValue, 2.6);
+}
+
+static double exactPower045(double unitValue)
+{
+    return pow(unitValue, 1.0 / 0.45);
+}
+
+static double exactCieLab(double unitValue)
+{
+    return (unitValue <= 0.08) ? unitValue / 9.033 : pow((unitValue + 0.16) / 1.16, 3.0);
+}
+
+static double exactSrgb(double unitValue)
+{
+    return (unitValue <= 0.04045) ? unitValue / 12.92 : pow((unitValue + 0.055) / 1.055, 2.4);
+}
+
+// the documented max error for each V_SEGMENTS
+struct Limits
+{
+    double Max;
+    double MaxBelow8192;
+};
+
+static int s_failures = 0;
+
+template<typename T_CURVE, uint16_t V_SEGMENTS> 
+static void check(const char* name, double (*exact)(double), Limits limits)
+{
+    typedef NeoGammaSegmentTableMethod<T_CURVE, V_SEGMENTS> Method;
+
+    double maxError = 0.0;
+    double maxErrorBelow8192 = 0.0;
+    int maxError8 = 0;
+
+    for (uint32_t value = 0; value <= 0xffff; value++)
+    {
+        double error = fabs(Method::Correct(static_cast<uint16_t>(value)) - 65535.0 * exact(value / 65535.0));
+
+        if (error > maxError)
+        {
+            maxError = error;
+        }
+        if (value < 8192 && error > maxErrorBelow8192)
+        {
+            maxErrorBelow8192 = error;
+        }
+    }
+
+    for (uint16_t value = 0; value <= 0xff; value++)
+    {
+        int expected = static_cast<int>(255.0 * exact(value / 255.0) + 0.5);
+        int error = abs(Method::Correct(static_cast<uint8_t>(value)) - expected);
+
+        if (error > maxError8)
+        {
+            maxError8 = error;
+        }
+    }
+
+    bool passed = (maxError <= limits.Max && 
+        maxErrorBelow8192 <= limits.MaxBelow8192 &&
+        maxError8 <= 1);
+
+    printf("%-6s %3u segments  max error %5.2f  below 8192 %5.2f  8 bit %d  %s\n",
+        name,
+        V_SEGMENTS,
+        maxError,
+        maxErrorBelow8192,
+        maxError8,
+        passed ? "" : "FAILED");
+
+    if (!passed)
+    {
+        s_failures++;
+    }
+}
+
+template<uint16_t V_SEGMENTS> 
+static void checkCurves(Limits limits)
+{
+    check<NeoGammaPowerCurve<260>, V_SEGMENTS>("2.6", exactPower26, limits);
+    check<NeoGammaPowerCurve<100, 45>, V_SEGMENTS>("1/0.45", exactPower045, limits);
+    check<NeoGammaCieLabCurve, V_SEGMENTS>("CIE L*", exactCieLab, limits);
+    check<NeoGammaSrgbCurve, V_SEGMENTS>("sRGB", exactSrgb, limits);
+}
+
+int main()
+{
+    checkCurves<64>({ 9.5, 3.6 });
+    checkCurves<128>({ 3.2, 1.6 });
+    checkCurves<256>({ 1.9, 1.2 });
+
+    return s_failures;
+}
@@ -0,0 +1,258 @@
+/*-------------------------------------------------------------------------
+NeoRleEncoder - host tool that converts a bitmap file into the run length
+encoded PROGMEM data used by NeoBufferRleProgmemMethod
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+// This is not part of the library build, compile it on the host with
+//      c++ -O2 -o NeoRleEncoder NeoRleEncoder.cpp
+// and run it as
+//      NeoRleEncoder <file.bmp> <order> [name] > image.h
+// where order is the element order of the feature, like GRB for NeoGrbFeature
+// or GRBW for NeoGrbwFeature; W is taken from the alpha byte of 32 bit bitmaps
+// Only uncompressed 24 and 32 bit bitmaps are supported, like NeoBitmapFile.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include <string>
+
+static const size_t MaxPacketCount = 128;
+
+static uint32_t readLe(const std::vector<uint8_t>& data, size_t offset, size_t size)
+{
+    uint32_t value = 0;
+
+    for (size_t b = 0; b < size; b++)
+    {
+        value |= static_cast<uint32_t>(data[offset + b]) << (b * 8);
+    }
+    return value;
+}
+
+static bool loadBitmap(const char* path,
+    const std::string& order,
+    uint16_t* width,
+    uint16_t* height,
+    std::vector<uint8_t>* pixels)
+{
+    FILE* file = fopen(path, "rb");
+
+    if (file == nullptr)
+    {
+        fprintf(stderr, "unable to open %s\n", path);
+        return false;
+    }
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t read;
+
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        data.insert(data.end(), chunk, chunk + read);
+    }
+    fclose(file);
+
+    if (data.size() < 54 || readLe(data, 0, 2) != 0x4d42)
+    {
+        fprintf(stderr, "%s is not a bitmap\n", path);
+        return false;
+    }
+
+    uint32_t pixelAddress = readLe(data, 10, 4);
+    int32_t bmpWidth = static_cast<int32_t>(readLe(data, 18, 4));
+    int32_t bmpHeight = static_cast<int32_t>(readLe(data, 22, 4));
+    uint16_t bitsPerPixel = readLe(data, 28, 2);
+    uint32_t compression = readLe(data, 30, 4);
+
+    if (compression != 0 || (bitsPerPixel != 24 && bitsPerPixel != 32))
+    {
+        fprintf(stderr, "only uncompressed 24 and 32 bit bitmaps are supported\n");
+        return false;
+    }
+
+    bool bottomToTop = (bmpHeight > 0);
+    size_t bytesPerPixel = bitsPerPixel / 8;
+
+    *width = static_cast<uint16_t>(bmpWidth < 0 ? -bmpWidth : bmpWidth);
+    *height = static_cast<uint16_t>(bmpHeight < 0 ? -bmpHeight : bmpHeight);
+
+    size_t sizeRow = (bitsPerPixel * *width + 31) / 32 * 4;
+
+    if (pixelAddress + sizeRow * *height > data.size())
+    {
+        fprintf(stderr, "%s is truncated\n", path);
+        return false;
+    }
+
+    pixels->clear();
+    for (uint16_t y = 0; y < *height; y++)
+    {
+        uint16_t yFile = bottomToTop ? (*height - 1 - y) : y;
+        const uint8_t* pRow = data.data() + pixelAddress + yFile * sizeRow;
+
+        for (uint16_t x = 0; x < *width; x++)
+        {
+            const uint8_t* bgra = pRow + x * bytesPerPixel;
+
+            for (char element : order)
+            {
+                switch (element)
+                {
+                case 'R':
+                    pixels->push_back(bgra[2]);
+                    break;
+                case 'G':
+                    pixels->push_back(bgra[1]);
+                    break;
+                case 'B':
+                    pixels->push_back(bgra[0]);
+                    break;
+                default:
+                    pixels->push_back(bytesPerPixel == 4 ? bgra[3] : 0);
+                    break;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+// encodes one row, runs of 2 or more equal pixels become run packets
+static void encodeRow(const uint8_t* pRow,
+    uint16_t width,
+    size_t pixelSize,
+    std::vector<uint8_t>* packets)
+{
+    uint16_t x = 0;
+
+    while (x < width)
+    {
+        // measure the run starting here
+        uint16_t count = 1;
+
+        while (x + count < width &&
+            count < MaxPacketCount &&
+            memcmp(pRow + x * pixelSize, pRow + (x + count) * pixelSize, pixelSize) == 0)
+        {
+            count++;
+        }
+
+        if (count > 1)
+        {
+            packets->push_back(0x80 | (count - 1));
+            packets->insert(packets->end(), pRow + x * pixelSize, pRow + (x + 1) * pixelSize);
+            x += count;
+            continue;
+        }
+
+        // literal until the next run of two starts
+        count = 1;
+        while (x + count < width &&
+            count < MaxPacketCount &&
+            !(x + count + 1 < width &&
+                memcmp(pRow + (x + count) * pixelSize, pRow + (x + count + 1) * pixelSize, pixelSize) == 0))
+        {
+            count++;
+        }
+
+        packets->push_back(count - 1);
+        packets->insert(packets->end(), pRow + x * pixelSize, pRow + (x + count) * pixelSize);
+        x += count;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: NeoRleEncoder <file.bmp> <order> [name]\n");
+        return 1;
+    }
+
+    std::string order(argv[2]);
+    std::string name(argc > 3 ? argv[3] : "image");
+    uint16_t width;
+    uint16_t height;
+    std::vector<uint8_t> pixels;
+
+    if (order.empty() || order.find_first_not_of("RGBW") != std::string::npos)
+    {
+        fprintf(stderr, "order must only contain R, G, B, and W\n");
+        return 1;
+    }
+
+    if (!loadBitmap(argv[1], order, &width, &height, &pixels))
+    {
+        return 1;
+    }
+
+    const size_t pixelSize = order.size();
+    std::vector<uint8_t> packets;
+    std::vector<uint8_t> encoded;
+
+    for (uint16_t y = 0; y < height; y++)
+    {
+        size_t offset = packets.size();
+
+        if (offset > 0xffff)
+        {
+            fprintf(stderr, "encoded image is too large, split it into smaller images\n");
+            return 1;
+        }
+        encoded.push_back(offset & 0xff);
+        encoded.push_back(offset >> 8);
+
+        encodeRow(pixels.data() + y * width * pixelSize, width, pixelSize, &packets);
+    }
+    encoded.insert(encoded.end(), packets.begin(), packets.end());
+
+    printf("// %s %ux%u %s, %u bytes encoded from %u bytes\n",
+        argv[1],
+        width,
+        height,
+        order.c_str(),
+        static_cast<unsigned>(encoded.size()),
+        static_cast<unsigned>(pixels.size()));
+    printf("// NeoBuffer<NeoBufferRleProgmemMethod<Feature>> %s(%s_width, %s_height, %s_pixels);\n",
+        name.c_str(),
+        name.c_str(),
+        name.c_str(),
+        name.c_str());
+    printf("const uint16_t %s_width = %u;\n", name.c_str(), width);
+    printf("const uint16_t %s_height = %u;\n", name.c_str(), height);
+    printf("const uint8_t %s_pixels[] PROGMEM = {", name.c_str());
+
+    for (size_t index = 0; index < encoded.size(); index++)
+    {
+        printf("%s0x%02x,", (index % 16) ? " " : "\n    ", encoded[index]);
+    }
+    printf("\n};\n");
+
+    return 0;
+}
@@ -27,6 +27,7 @@ License along with NeoPixel.  If not, see
 #pragma once
 
 #include <Arduino.h>
+#include "internal/animations/NeoProgress16.h"
 #include "internal/animations/NeoEase.h"
 
 enum AnimationState
@@ -41,11 +42,15 @@ struct AnimationParam
     float progress;
     uint16_t index;
     AnimationState state;
+    // progress as a fixed point value for integer only pipelines, last so
+    // initializers of the members above still compile
+    NeoProgress16 progress16;
 };
 
 #if defined(NEOPIXEBUS_NO_STL)
 
 typedef void(*AnimUpdateCallback)(const AnimationParam& param);
+typedef unsigned long(*AnimClockFunction)();
 
 #else
 
@@ -53,20 +58,28 @@ typedef void(*AnimUpdateCallback)(const AnimationParam& param);
 #undef min
 #include <functional>
 typedef std::function<void(const AnimationParam& param)> AnimUpdateCallback;
+typedef std::function<unsigned long()> AnimClockFunction;
 
 #endif
 
 
-#define NEO_MILLISECONDS        1    // ~65 seconds max duration, ms updates
-#define NEO_CENTISECONDS       10    // ~10.9 minutes max duration, centisecond updates
-#define NEO_DECISECONDS       100    // ~1.8 hours max duration, decisecond updates
-#define NEO_SECONDS          1000    // ~18.2 hours max duration, second updates
-#define NEO_DECASECONDS     10000    // ~7.5 days, 10 second updates
+#define NEO_MILLISECONDS        1    // ~49.7 days max duration, ms updates
+#define NEO_CENTISECONDS       10    // ~1.4 years max duration, centisecond updates
+#define NEO_DECISECONDS       100    // ~13.6 years max duration, decisecond updates
+#define NEO_SECONDS          1000    // ~136 years max duration, second updates
+#define NEO_DECASECONDS     10000    // ~1361 years, 10 second updates
+
+// the time scales above are for the default millis clock; with micros as the 
+// clock, a time scale of 1 gives microsecond updates (~71 minutes max duration)
+// and 1000 gives millisecond durations with updates that keep the fraction; 
+// any other clock, like a frame counter, counts in its own units
 
 class NeoPixelAnimator
 {
 public:
-    NeoPixelAnimator(uint16_t countAnimations, uint16_t timeScale = NEO_MILLISECONDS);
+    NeoPixelAnimator(uint16_t countAnimations, 
+        uint16_t timeScale = NEO_MILLISECONDS,
+        AnimClockFunction clock = millis);
     ~NeoPixelAnimator();
 
     bool IsAnimating() const
@@ -75,9 +88,12 @@ public:
     }
 
 
+    // when indexStart is zero the lowest available animation is taken from 
+    // the free list in constant time, otherwise the animations are searched 
+    // starting at indexStart
     bool NextAvailableAnimation(uint16_t* indexAvailable, uint16_t indexStart = 0);
 
-    void StartAnimation(uint16_t indexAnimation, uint16_t duration, AnimUpdateCallback animUpdate);
+    void StartAnimation(uint16_t indexAnimation, uint32_t duration, AnimUpdateCallback animUpdate);
     void StopAnimation(uint16_t indexAnimation);
     void StopAll();
 
@@ -100,7 +116,7 @@ public:
         return (IsAnimating() && _animations[indexAnimation]._remaining != 0);
     }
 
-    uint16_t AnimationDuration(uint16_t indexAnimation)
+    uint32_t AnimationDuration(uint16_t indexAnimation)
     {
         if (indexAnimation >= _countAnimations)
         {
@@ -109,8 +125,11 @@ public:
         return _animations[indexAnimation]._duration;
     }
 
-    void ChangeAnimationDuration(uint16_t indexAnimation, uint16_t newDuration);
+    void ChangeAnimationDuration(uint16_t indexAnimation, uint32_t newDuration);
 
+    // calls the active animations in the order they were started, oldest
+    // first, so a later started animation writes over an earlier one; those 
+    // started from a callback are first updated on the next call
     void UpdateAnimations();
 
     bool IsPaused()
@@ -126,7 +145,7 @@ public:
     void Resume()
     {
         _isRunning = true;
-        _animationLastTick = millis();
+        _animationLastTick = _clock();
     }
 
     uint16_t getTimeScale()
@@ -139,16 +158,29 @@ public:
         _timeScale = (timeScale < 1) ? (1) : (timeScale > 32768) ? 32768 : timeScale;
     }
 
+    // ------------------------------------------------------------------------
+    // setClock replaces the time source, like micros or a function that 
+    // returns a frame count or the time of a host benchmark, so animations 
+    // can be driven deterministically; it must count up and may wrap
+    // ------------------------------------------------------------------------
+    void setClock(AnimClockFunction clock)
+    {
+        _clock = clock;
+        _animationLastTick = _clock();
+    }
+
 private:
     struct AnimationContext
     {
         AnimationContext() :
             _duration(0),
             _remaining(0),
-            _fnCallback(NULL)
+            _fnCallback(NULL),
+            _prev(IndexNone),
+            _next(IndexNone)
         {}
 
-        void StartAnimation(uint16_t duration, AnimUpdateCallback animUpdate)
+        void StartAnimation(uint32_t duration, AnimUpdateCallback animUpdate)
         {
             _duration = duration;
             _remaining = duration;
@@ -160,21 +192,39 @@ private:
             _remaining = 0;
         }
 
-        float CurrentProgress()
+        NeoProgress16 CurrentProgress()
         {
-            return (float)(_duration - _remaining) / (float)_duration;
+            return NeoProgress16::FromRatio(_duration - _remaining, _duration);
         }
 
-        uint16_t _duration;
-        uint16_t _remaining;
+        uint32_t _duration;
+        uint32_t _remaining;
        
         AnimUpdateCallback _fnCallback;
+
+        // links of the list this animation is in, active or free
+        uint16_t _prev;
+        uint16_t _next;
     };
 
+    static const uint16_t IndexNone = 0xffff;
+
+    void listRemove(uint16_t* head, uint16_t* tail, uint16_t indexAnimation);
+    void listAppend(uint16_t indexAnimation);
+    void listInsertFree(uint16_t indexAnimation);
+    void resetLists();
+
     uint16_t _countAnimations;
     AnimationContext* _animations;
+    uint16_t _activeHead; // active animations, in the order started
+    uint16_t _activeTail;
+    uint16_t _freeHead; // stopped animations, in index order
+    uint16_t _updateNext; // the next active animation while updating
+    uint16_t _updateEnd; // the first animation started while updating
+    AnimClockFunction _clock;
     uint32_t _animationLastTick;
     uint16_t _activeAnimations;
     uint16_t _timeScale;
     bool _isRunning;
+    bool _isUpdating;
 };
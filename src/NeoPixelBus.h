@@ -43,12 +43,18 @@ typedef union {
 } neo_flags_t;
 
 #include "internal/NeoUtil.h"
+#include "internal/animations/NeoProgress16.h"
 #include "internal/animations/NeoEase.h"
 #include "internal/NeoSettings.h"
 #include "internal/NeoColors.h"
 #include "internal/NeoColorFeatures.h"
-#include "internal/NeoTopologies.h"
 #include "internal/NeoBuffers.h"
+#include "internal/NeoTopologies.h"
+#include "internal/animations/NeoTimeline.h"
+#include "internal/animations/NeoFrameScheduler.h"
+#include "internal/animations/NeoParticleSystem.h"
+#include "internal/animations/NeoNoise.h"
+#include "internal/animations/NeoNoiseEffects.h"
 #include "internal/NeoBusChannel.h"
 #include "internal/NeoMethods.h"
 #include "internal/XMethods.h"
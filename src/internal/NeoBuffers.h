@@ -28,13 +28,21 @@ License along with NeoPixel.  If not, see
 #include "buffers/LayoutMapCallback.h"
 #include "buffers/NeoShaderNop.h"
 #include "buffers/NeoShaderBase.h"
+#include "buffers/NeoWhiteExtractor.h"
 #include "buffers/NeoBufferContext.h"
+#include "buffers/NeoBltTransform.h"
+#include "buffers/NeoBlendSpan.h"
 
 #include "buffers/NeoBuffer.h"
 #include "buffers/NeoBufferMethods.h"
 #include "buffers/NeoBufferProgmemMethod.h"
+#include "buffers/NeoBufferRleProgmemMethod.h"
+#include "buffers/NeoBufferPaletteMethod.h"
 
 #include "buffers/NeoDib.h"
 #include "buffers/NeoBitmapFile.h"
 #include "buffers/NeoVerticalSpriteSheet.h"
+#include "buffers/NeoSpriteAtlas.h"
+#include "buffers/NeoFont5x7.h"
+#include "buffers/NeoTextStrip.h"
 
@@ -37,6 +37,8 @@ License along with NeoPixel.  If not, see
 
 #include "colors/HslColor.h"
 #include "colors/HsbColor.h"
+#include "colors/Hsl32Color.h"
+#include "colors/Hsb32Color.h"
 #include "colors/HtmlColor.h"
 
 #include "colors/RgbwColor.h"
@@ -47,6 +49,9 @@ License along with NeoPixel.  If not, see
 
 #include "colors/RgbwwwColor.h"
 
+#include "colors/NeoCctMixTable.h"
+#include "colors/NeoOklabBlend.h"
+
 #include "colors/SegmentDigit.h"
 
 #include "colors/NeoGamma.h"
@@ -54,5 +59,8 @@ License along with NeoPixel.  If not, see
 #include "colors/NeoGammaCieLabEquationMethod.h"
 #include "colors/NeoGammaTableMethod.h"
 #include "colors/NeoGammaDynamicTableMethod.h"
+#include "colors/NeoGammaCurves.h"
+#include "colors/NeoGammaSegmentTableMethod.h"
+#include "colors/NeoGammaCurveTableMethod.h"
 #include "colors/NeoGammaNullMethod.h"
 #include "colors/NeoGammaInvertMethod.h"
@@ -35,5 +35,9 @@ License along with NeoPixel.  If not, see
 #include "topologies/NeoRingTopology.h"
 #include "topologies/NeoTiles.h"
 #include "topologies/NeoMosaic.h"
+#include "topologies/NeoTopologyCache.h"
+#include "topologies/NeoSampleTable.h"
+#include "topologies/NeoPointTopology.h"
+#include "topologies/NeoRingPolar.h"
 
 
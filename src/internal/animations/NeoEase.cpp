@@ -0,0 +1,135 @@
+/*-------------------------------------------------------------------------
+NeoEase provides animation curve equations for animation support.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#include <Arduino.h>
+#include "NeoProgress16.h"
+#include "NeoEase.h"
+
+// sin(unitValue * HALF_PI) sampled at 64 segments
+static const uint16_t c_QuarterSine[65] PROGMEM = {
+        0,  1608,  3216,  4821,  6424,  8022,  9616, 11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25079, 26557, 28020, 29465, 30893, 32302, 33692, 35061,
+    36409, 37736, 39039, 40319, 41575, 42806, 44011, 45189,
+    46340, 47464, 48558, 49624, 50659, 51664, 52638, 53580,
+    54490, 55367, 56211, 57021, 57797, 58537, 59243, 59913,
+    60546, 61144, 61704, 62227, 62713, 63161, 63571, 63943,
+    64276, 64570, 64826, 65042, 65219, 65357, 65456, 65515,
+    65535
+};
+
+// pow(2, -unitValue) sampled at 32 segments
+static const uint16_t c_Exp2Fraction[33] PROGMEM = {
+    65535, 64131, 62757, 61412, 60096, 58808, 57548, 56315,
+    55108, 53927, 52772, 51641, 50534, 49452, 48392, 47355,
+    46340, 45347, 44376, 43425, 42494, 41584, 40693, 39821,
+    38967, 38132, 37315, 36516, 35733, 34968, 34218, 33485,
+    32768
+};
+
+// pow(unitValue, 1.0 / 0.45) sampled at 64 segments
+static const uint16_t c_Gamma[65] PROGMEM = {
+        0,     6,    30,    73,   138,   227,   340,   479,
+      645,   838,  1059,  1309,  1588,  1897,  2237,  2608,
+     3010,  3444,  3911,  4410,  4942,  5508,  6108,  6742,
+     7411,  8115,  8854,  9628, 10439, 11285, 12168, 13088,
+    14045, 15039, 16070, 17140, 18247, 19392, 20576, 21799,
+    23061, 24362, 25702, 27081, 28501, 29960, 31460, 33000,
+    34581, 36202, 37864, 39568, 41312, 43099, 44927, 46796,
+    48708, 50662, 52659, 54697, 56779, 58903, 61071, 63281,
+    65535
+};
+
+// interpolates a table of (2^bits + 1) samples over the unit range
+static uint16_t interpolate(const uint16_t* table, uint8_t bits, uint16_t value)
+{
+    // stretch 65535 to 65536 so the last sample is reached exactly
+    uint32_t position = static_cast<uint32_t>(value) + (value >> 15);
+    uint8_t shift = 16 - bits;
+    uint16_t index = position >> shift;
+    uint32_t fraction = position & ((1 << shift) - 1);
+    uint16_t result = pgm_read_word(&table[index]);
+
+    if (fraction)
+    {
+        int32_t delta = static_cast<int32_t>(pgm_read_word(&table[index + 1])) - result;
+
+        result += (delta * static_cast<int32_t>(fraction) + (1 << (shift - 1))) >> shift;
+    }
+    return result;
+}
+
+NeoProgress16 NeoEase16::Gamma(NeoProgress16 unitValue)
+{
+    return NeoProgress16(interpolate(c_Gamma, 6, unitValue.Value));
+}
+
+uint16_t NeoEase16::quarterSine(uint16_t value)
+{
+    return interpolate(c_QuarterSine, 6, value);
+}
+
+uint16_t NeoEase16::exponential(uint16_t value)
+{
+    // pow(2, 10 * (value - 1)) as pow(2, -whole) * pow(2, -fraction)
+    uint32_t exponent = static_cast<uint32_t>(One - value) * 10;
+    uint8_t whole = exponent >> 16;
+    uint16_t fraction = exponent & 0xffff;
+
+    return interpolate(c_Exp2Fraction, 5, fraction) >> whole;
+}
+
+uint16_t NeoEase16::circular(uint16_t value)
+{
+    // 1 - sqrt(1 - value * value) with an integer square root
+    uint32_t remainder = static_cast<uint32_t>(One) * One - static_cast<uint32_t>(value) * value;
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > remainder)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (remainder >= root + bit)
+        {
+            remainder -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    // round to nearest
+    if (remainder > root)
+    {
+        root++;
+    }
+    return One - root;
+}
@@ -29,6 +29,7 @@ License along with NeoPixel.  If not, see
 #if defined(NEOPIXEBUS_NO_STL)
 
 typedef float(*AnimEaseFunction)(float unitValue);
+typedef NeoProgress16(*AnimEaseFunction16)(NeoProgress16 unitValue);
 
 #else
 
@@ -36,6 +37,7 @@ typedef float(*AnimEaseFunction)(float unitValue);
 #undef min
 #include <functional>
 typedef std::function<float(float unitValue)> AnimEaseFunction;
+typedef std::function<NeoProgress16(NeoProgress16 unitValue)> AnimEaseFunction16;
 
 #endif
 
@@ -321,4 +323,248 @@ public:
             return pow((unitValue + 0.16f) / 1.16f, 3.0f);
         }
     }
-};
\ No newline at end of file
+};
+
+// NeoEase16 provides the same curves as NeoEase using NeoProgress16 and 
+// integer math; the polynomial curves are calculated directly, the 
+// sinusoidal, exponential and gamma curves interpolate small tables and the 
+// circular curves use an integer square root
+//
+class NeoEase16
+{
+public:
+    static NeoProgress16 Linear(NeoProgress16 unitValue)
+    {
+        return unitValue;
+    }
+
+    static NeoProgress16 QuadraticIn(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(quadratic(unitValue.Value));
+    }
+
+    static NeoProgress16 QuadraticOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeOut(unitValue.Value, quadratic));
+    }
+
+    static NeoProgress16 QuadraticInOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeInOut(unitValue.Value, quadratic));
+    }
+
+    static NeoProgress16 QuadraticCenter(NeoProgress16 unitValue)
+    {
+        // matches NeoEase::QuadraticCenter, which starts at 1.0, drops to 
+        // 0.5 at the center and returns to 1.0
+        uint16_t value = unitValue.Value;
+
+        if (value < Half)
+        {
+            return NeoProgress16(One - (quadratic(value * 2) >> 1));
+        }
+        return NeoProgress16((One + quadratic(value * 2 - One)) >> 1);
+    }
+
+    static NeoProgress16 CubicIn(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(cubic(unitValue.Value));
+    }
+
+    static NeoProgress16 CubicOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeOut(unitValue.Value, cubic));
+    }
+
+    static NeoProgress16 CubicInOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeInOut(unitValue.Value, cubic));
+    }
+
+    static NeoProgress16 CubicCenter(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeCenter(unitValue.Value, cubic));
+    }
+
+    static NeoProgress16 QuarticIn(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(quartic(unitValue.Value));
+    }
+
+    static NeoProgress16 QuarticOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeOut(unitValue.Value, quartic));
+    }
+
+    static NeoProgress16 QuarticInOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeInOut(unitValue.Value, quartic));
+    }
+
+    static NeoProgress16 QuarticCenter(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeCenter(unitValue.Value, quartic));
+    }
+
+    static NeoProgress16 QuinticIn(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(quintic(unitValue.Value));
+    }
+
+    static NeoProgress16 QuinticOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeOut(unitValue.Value, quintic));
+    }
+
+    static NeoProgress16 QuinticInOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeInOut(unitValue.Value, quintic));
+    }
+
+    static NeoProgress16 QuinticCenter(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeCenter(unitValue.Value, quintic));
+    }
+
+    static NeoProgress16 SinusoidalIn(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(One - quarterSine(One - unitValue.Value));
+    }
+
+    static NeoProgress16 SinusoidalOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(quarterSine(unitValue.Value));
+    }
+
+    static NeoProgress16 SinusoidalInOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeCenter(unitValue.Value, quarterSine));
+    }
+
+    static NeoProgress16 SinusoidalCenter(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeInOut(unitValue.Value, quarterSine));
+    }
+
+    static NeoProgress16 ExponentialIn(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(exponential(unitValue.Value));
+    }
+
+    static NeoProgress16 ExponentialOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeOut(unitValue.Value, exponential));
+    }
+
+    static NeoProgress16 ExponentialInOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeInOut(unitValue.Value, exponential));
+    }
+
+    static NeoProgress16 ExponentialCenter(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeCenter(unitValue.Value, exponential));
+    }
+
+    static NeoProgress16 CircularIn(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(circular(unitValue.Value));
+    }
+
+    static NeoProgress16 CircularOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeOut(unitValue.Value, circular));
+    }
+
+    static NeoProgress16 CircularInOut(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeInOut(unitValue.Value, circular));
+    }
+
+    static NeoProgress16 CircularCenter(NeoProgress16 unitValue)
+    {
+        return NeoProgress16(easeCenter(unitValue.Value, circular));
+    }
+
+    static NeoProgress16 Gamma(NeoProgress16 unitValue);
+
+    static NeoProgress16 GammaCieLab(NeoProgress16 unitValue)
+    {
+        uint16_t value = unitValue.Value;
+
+        if (value <= 5242) // 0.08
+        {
+            // value / 9.033
+            return NeoProgress16((static_cast<uint32_t>(value) * 7255 + 0x8000) >> 16);
+        }
+
+        // pow((value + 0.16) / 1.16, 3)
+        uint16_t base = ((static_cast<uint32_t>(value) + 10486) * 56497) >> 16;
+        return NeoProgress16(cubic(base));
+    }
+
+private:
+    static const uint16_t One = NeoProgress16::Max;
+    static const uint16_t Half = 32768;
+
+    // the curve shapes, all take and return a 16 bit fraction
+    typedef uint16_t(*Curve)(uint16_t value);
+
+    // value * other / One, rounded
+    static uint16_t multiply(uint16_t value, uint16_t other)
+    {
+        uint32_t product = static_cast<uint32_t>(value) * other + 0x8000;
+
+        return (product + (product >> 16)) >> 16;
+    }
+
+    static uint16_t quadratic(uint16_t value)
+    {
+        return multiply(value, value);
+    }
+
+    static uint16_t cubic(uint16_t value)
+    {
+        return multiply(quadratic(value), value);
+    }
+
+    static uint16_t quartic(uint16_t value)
+    {
+        return quadratic(quadratic(value));
+    }
+
+    static uint16_t quintic(uint16_t value)
+    {
+        return multiply(quartic(value), value);
+    }
+
+    static uint16_t quarterSine(uint16_t value);
+    static uint16_t exponential(uint16_t value);
+    static uint16_t circular(uint16_t value);
+
+    // the mirror of the in curve
+    static uint16_t easeOut(uint16_t value, Curve curve)
+    {
+        return One - curve(One - value);
+    }
+
+    // the in curve to the center, then the out curve
+    static uint16_t easeInOut(uint16_t value, Curve curve)
+    {
+        if (value < Half)
+        {
+            return curve(value * 2) >> 1;
+        }
+        return One - (curve((One - value) * 2) >> 1);
+    }
+
+    // the out curve to the center, then the in curve
+    static uint16_t easeCenter(uint16_t value, Curve curve)
+    {
+        if (value < Half)
+        {
+            return (One - curve(One - value * 2)) >> 1;
+        }
+        return (One + curve(value * 2 - One)) >> 1;
+    }
+};
@@ -0,0 +1,210 @@
+/*-------------------------------------------------------------------------
+NeoFrameScheduler paces rendering to a target frame rate and to the time
+the buses need to send a frame
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoFrameScheduler decides when the main loop should render and show the
+// next frame, so frames are not rendered only to then block in Show() while 
+// the previous frame is still being sent.
+// A frame is ready when its time has come and the buses can show, the frame
+// period is the longer of the target frame rate and the longest bus send
+// time. Frames that are started late are counted, and frame times that are 
+// missed entirely are skipped and counted as dropped.
+//
+//    if (scheduler.Ready(strip))
+//    {
+//        animations.UpdateAnimations();
+//        strip.Show();
+//    }
+//
+class NeoFrameScheduler
+{
+public:
+    NeoFrameScheduler(uint16_t framesPerSecond) :
+        _targetPeriodUs(1000000UL / (framesPerSecond ? framesPerSecond : 1)),
+        _transmitUs(0),
+        _nextFrameUs(0),
+        _lastLatenessUs(0),
+        _framesShown(0),
+        _framesLate(0),
+        _framesDropped(0),
+        _started(false)
+    {
+        updatePeriod();
+    }
+
+    // ------------------------------------------------------------------------
+    // TransmitTimeUs returns the time to send sizeData bytes and the reset 
+    // at a NeoBitsSpeed, like NeoBitsSpeedWs2812x, rounded up to the next us
+    // ------------------------------------------------------------------------
+    template <typename T_SPEED> static uint32_t TransmitTimeUs(size_t sizeData)
+    {
+        // from the bit time, as the whole us per byte of ByteSendTimeUs 
+        // under counts by up to a us per byte
+        uint64_t sendNs = static_cast<uint64_t>(T_SPEED::BitSendTimeNs) * 8 * sizeData;
+
+        return static_cast<uint32_t>((sendNs + 999) / 1000) + T_SPEED::ResetTimeUs;
+    }
+
+    // ------------------------------------------------------------------------
+    // AddBus includes a bus sending sizeData bytes at T_SPEED, like 
+    // strip.PixelsSize(); buses send in parallel so the longest one limits 
+    // the frame rate
+    // ------------------------------------------------------------------------
+    template <typename T_SPEED> void AddBus(size_t sizeData)
+    {
+        AddTransmitTime(TransmitTimeUs<T_SPEED>(sizeData));
+    }
+
+    // AddTransmitTime includes a bus by its send time, for methods without
+    // a NeoBitsSpeed
+    void AddTransmitTime(uint32_t transmitUs)
+    {
+        if (transmitUs > _transmitUs)
+        {
+            _transmitUs = transmitUs;
+            updatePeriod();
+        }
+    }
+
+    void SetFramesPerSecond(uint16_t framesPerSecond)
+    {
+        _targetPeriodUs = 1000000UL / (framesPerSecond ? framesPerSecond : 1);
+        updatePeriod();
+    }
+
+    uint32_t PeriodUs() const
+    {
+        return _periodUs;
+    }
+
+    // ------------------------------------------------------------------------
+    // Ready returns true when the next frame should be rendered and shown 
+    // now, it must then be shown as the frame is counted as shown
+    // bus - a bus, or anything with CanShow(), that will show the frame
+    // canShow - for more than one bus, like (strip1.CanShow() && strip2.CanShow())
+    // nowUs - the current time, like micros()
+    // ------------------------------------------------------------------------
+    template <typename T_BUS> bool Ready(T_BUS& bus)
+    {
+        return Ready(bus.CanShow(), micros());
+    }
+
+    bool Ready(bool canShow, uint32_t nowUs)
+    {
+        if (!_started)
+        {
+            _nextFrameUs = nowUs;
+            _started = true;
+        }
+
+        uint32_t lateness = nowUs - _nextFrameUs;
+
+        // not yet time, wrap safe
+        if (static_cast<int32_t>(lateness) < 0 || !canShow)
+        {
+            return false;
+        }
+
+        if (lateness >= _periodUs)
+        {
+            uint32_t missed = lateness / _periodUs;
+
+            _framesDropped += missed;
+            _nextFrameUs += missed * _periodUs;
+            lateness -= missed * _periodUs;
+        }
+
+        _lastLatenessUs = lateness;
+
+        // a quarter of a period late is visible as uneven motion, so the
+        // cadence restarts from now rather than the lateness adding up frame
+        // after frame when the bus is the limit
+        if (lateness > _periodUs / 4)
+        {
+            _framesLate++;
+            _nextFrameUs = nowUs;
+        }
+        _nextFrameUs += _periodUs;
+        _framesShown++;
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // TimeUntilFrameUs returns how long until the next frame is due, so the 
+    // loop can sleep or do other work instead of polling
+    // ------------------------------------------------------------------------
+    uint32_t TimeUntilFrameUs(uint32_t nowUs) const
+    {
+        int32_t remaining = static_cast<int32_t>(_nextFrameUs - nowUs);
+
+        return (!_started || remaining < 0) ? 0 : remaining;
+    }
+
+    uint32_t FramesShown() const
+    {
+        return _framesShown;
+    }
+
+    uint32_t FramesLate() const
+    {
+        return _framesLate;
+    }
+
+    uint32_t FramesDropped() const
+    {
+        return _framesDropped;
+    }
+
+    // how late the last frame was started
+    uint32_t LastLatenessUs() const
+    {
+        return _lastLatenessUs;
+    }
+
+    void ResetStats()
+    {
+        _framesShown = 0;
+        _framesLate = 0;
+        _framesDropped = 0;
+    }
+
+private:
+    uint32_t _targetPeriodUs;
+    uint32_t _transmitUs;
+    uint32_t _periodUs;
+    uint32_t _nextFrameUs;
+    uint32_t _lastLatenessUs;
+    uint32_t _framesShown;
+    uint32_t _framesLate;
+    uint32_t _framesDropped;
+    bool _started;
+
+    void updatePeriod()
+    {
+        _periodUs = (_transmitUs > _targetPeriodUs) ? _transmitUs : _targetPeriodUs;
+    }
+};
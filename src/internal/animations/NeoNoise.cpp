@@ -0,0 +1,218 @@
+/*-------------------------------------------------------------------------
+NeoNoise provides fixed point 2d and 3d gradient noise
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#include <Arduino.h>
+#include "NeoNoise.h"
+
+static const int32_t c_One = 0x4000; // Q14
+
+// Ken Perlin's reference permutation
+static const uint8_t c_Permutation[256] PROGMEM = {
+    151, 160, 137,  91,  90,  15, 131,  13, 201,  95,  96,  53, 194, 233,   7, 225,
+    140,  36, 103,  30,  69, 142,   8,  99,  37, 240,  21,  10,  23, 190,   6, 148,
+    247, 120, 234,  75,   0,  26, 197,  62,  94, 252, 219, 203, 117,  35,  11,  32,
+     57, 177,  33,  88, 237, 149,  56,  87, 174,  20, 125, 136, 171, 168,  68, 175,
+     74, 165,  71, 134, 139,  48,  27, 166,  77, 146, 158, 231,  83, 111, 229, 122,
+     60, 211, 133, 230, 220, 105,  92,  41,  55,  46, 245,  40, 244, 102, 143,  54,
+     65,  25,  63, 161,   1, 216,  80,  73, 209,  76, 132, 187, 208,  89,  18, 169,
+    200, 196, 135, 130, 116, 188, 159,  86, 164, 100, 109, 198, 173, 186,   3,  64,
+     52, 217, 226, 250, 124, 123,   5, 202,  38, 147, 118, 126, 255,  82,  85, 212,
+    207, 206,  59, 227,  47,  16,  58,  17, 182, 189,  28,  42, 223, 183, 170, 213,
+    119, 248, 152,   2,  44, 154, 163,  70, 221, 153, 101, 155, 167,  43, 172,   9,
+    129,  22,  39, 253,  19,  98, 108, 110,  79, 113, 224, 232, 178, 185, 112, 104,
+    218, 246,  97, 228, 251,  34, 242, 193, 238, 210, 144,  12, 191, 179, 162, 241,
+     81,  51, 145, 235, 249,  14, 239, 107,  49, 192, 214,  31, 181, 199, 106, 157,
+    184,  84, 204, 176, 115, 121,  50,  45, 127,   4, 150, 254, 138, 236, 205,  93,
+    222, 114,  67,  29,  24,  72, 243, 141, 128, 195,  78,  66, 215,  61, 156, 180
+};
+
+// the gradients x, y, z; 3d uses all 16 (the 12 cube edges, four repeated),
+// 2d uses the first 8 with z ignored, four diagonals and four axes
+static const int8_t c_Gradient3[16][3] = {
+    { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+    { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+    { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 },
+    { 1, 1, 0 }, { 0, -1, 1 }, { -1, 1, 0 }, { 0, -1, -1 }
+};
+
+static const int8_t c_Gradient2[8][2] = {
+    { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 },
+    { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }
+};
+
+uint8_t NeoNoise::hash(uint8_t index)
+{
+    return pgm_read_byte(&c_Permutation[index]);
+}
+
+// 6t^5 - 15t^4 + 10t^3 in Q14, as t^3 * (6t^2 - 15t + 10) to stay in range
+int32_t NeoNoise::fade(int32_t fraction)
+{
+    uint32_t t2 = (static_cast<uint32_t>(fraction) * fraction) >> 14;
+    uint32_t t3 = (t2 * fraction) >> 14;
+    uint32_t poly = 6 * t2 - 15 * fraction + 10 * c_One;
+
+    return (t3 * poly) >> 14;
+}
+
+// adds the two corners along x at one y and z, weighted by their y and z 
+// fade, to the cell; fractionY and fractionZ are relative to these corners
+void NeoNoise::addCorners(CellRow* cell,
+    int32_t weight,
+    uint8_t hash0,
+    uint8_t hash1,
+    int32_t fractionY,
+    int32_t fractionZ,
+    bool threeD)
+{
+    int32_t gx0;
+    int32_t gx1;
+    int32_t dot0;
+    int32_t dot1;
+
+    if (threeD)
+    {
+        const int8_t* g0 = c_Gradient3[hash0 & 15];
+        const int8_t* g1 = c_Gradient3[hash1 & 15];
+
+        gx0 = g0[0];
+        gx1 = g1[0];
+        dot0 = g0[1] * fractionY + g0[2] * fractionZ;
+        dot1 = g1[1] * fractionY + g1[2] * fractionZ;
+    }
+    else
+    {
+        const int8_t* g0 = c_Gradient2[hash0 & 7];
+        const int8_t* g1 = c_Gradient2[hash1 & 7];
+
+        gx0 = g0[0];
+        gx1 = g1[0];
+        dot0 = g0[1] * fractionY;
+        dot1 = g1[1] * fractionY;
+    }
+
+    // corner0 = gx0 * f + dot0, corner1 = gx1 * (f - 1) + dot1
+    cell->Base += weight * dot0;
+    cell->Slope += weight * gx0;
+    cell->Delta += weight * (dot1 - gx1 * c_One - dot0);
+    cell->DeltaSlope += weight * (gx1 - gx0);
+}
+
+void NeoNoise::Row(uint16_t* values,
+    uint16_t count,
+    uint32_t x,
+    uint32_t stepX,
+    uint32_t y)
+{
+    evaluateRow(values, count, x, stepX, y, 0, false);
+}
+
+void NeoNoise::Row(uint16_t* values,
+    uint16_t count,
+    uint32_t x,
+    uint32_t stepX,
+    uint32_t y,
+    uint32_t z)
+{
+    evaluateRow(values, count, x, stepX, y, z, true);
+}
+
+void NeoNoise::evaluateRow(uint16_t* values,
+    uint16_t count,
+    uint32_t x,
+    uint32_t stepX,
+    uint32_t y,
+    uint32_t z,
+    bool threeD)
+{
+    const uint8_t yi = y >> 16;
+    const uint8_t zi = z >> 16;
+    const int32_t fy = (y & 0xffff) >> 2;
+    const int32_t fz = (z & 0xffff) >> 2;
+    const int32_t v = fade(fy);
+    const int32_t w = threeD ? fade(fz) : 0;
+
+    CellRow cell;
+    uint32_t cellX = ~(x >> 16);
+
+    for (uint16_t index = 0; index < count; index++, x += stepX)
+    {
+        if ((x >> 16) != cellX)
+        {
+            cellX = x >> 16;
+
+            uint8_t hx0 = hash(cellX);
+            uint8_t hx1 = hash(cellX + 1);
+
+            cell.Base = 0;
+            cell.Slope = 0;
+            cell.Delta = 0;
+            cell.DeltaSlope = 0;
+
+            if (threeD)
+            {
+                uint8_t y00 = hash(hx0 + yi) + zi;
+                uint8_t y01 = hash(hx0 + yi + 1) + zi;
+                uint8_t y10 = hash(hx1 + yi) + zi;
+                uint8_t y11 = hash(hx1 + yi + 1) + zi;
+                int32_t wy0z0 = ((c_One - v) * (c_One - w)) >> 14;
+                int32_t wy1z0 = (v * (c_One - w)) >> 14;
+                int32_t wy0z1 = ((c_One - v) * w) >> 14;
+                int32_t wy1z1 = (v * w) >> 14;
+
+                addCorners(&cell, wy0z0, hash(y00), hash(y10), fy, fz, true);
+                addCorners(&cell, wy1z0, hash(y01), hash(y11), fy - c_One, fz, true);
+                addCorners(&cell, wy0z1, hash(y00 + 1), hash(y10 + 1), fy, fz - c_One, true);
+                addCorners(&cell, wy1z1, hash(y01 + 1), hash(y11 + 1), fy - c_One, fz - c_One, true);
+            }
+            else
+            {
+                addCorners(&cell, c_One - v, hash(hx0 + yi), hash(hx1 + yi), fy, 0, false);
+                addCorners(&cell, v, hash(hx0 + yi + 1), hash(hx1 + yi + 1), fy - c_One, 0, false);
+            }
+
+            cell.Base >>= 14;
+            cell.Delta >>= 14;
+        }
+
+        int32_t fx = (x & 0xffff) >> 2;
+        int32_t u = fade(fx);
+        int32_t noise = cell.Base + 
+            ((cell.Slope * fx) >> 14) +
+            (((cell.Delta + ((cell.DeltaSlope * fx) >> 14)) * u) >> 14);
+
+        // noise is within about +-1.0 (Q14), widened to fill the range
+        noise = 0x8000 + noise * 2;
+        if (noise < 0)
+        {
+            noise = 0;
+        }
+        else if (noise > 0xffff)
+        {
+            noise = 0xffff;
+        }
+        values[index] = noise;
+    }
+}
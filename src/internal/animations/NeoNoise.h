@@ -0,0 +1,100 @@
+/*-------------------------------------------------------------------------
+NeoNoise provides fixed point 2d and 3d gradient noise
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoNoise is integer gradient (Perlin) noise, the basis of organic effects
+// like fire, plasma and clouds, without any floating point math.
+// Coordinates are 16.16 fixed point in noise cells, so 0x10000 is one cell 
+// and the noise repeats every 256 cells; the results are 0 to 65535 and 
+// center on 32768.
+// The Row methods evaluate a run of points along x at once, the lattice 
+// work is only done once per cell rather than per point, which is most of
+// the cost when there are several points per cell.
+//
+class NeoNoise
+{
+public:
+    static uint16_t Noise(uint32_t x, uint32_t y)
+    {
+        uint16_t value;
+
+        Row(&value, 1, x, 0, y);
+        return value;
+    }
+
+    static uint16_t Noise(uint32_t x, uint32_t y, uint32_t z)
+    {
+        uint16_t value;
+
+        Row(&value, 1, x, 0, y, z);
+        return value;
+    }
+
+    // ------------------------------------------------------------------------
+    // Row fills values with count points of noise starting at x and moving
+    // by stepX for each, at the given y and z
+    // ------------------------------------------------------------------------
+    static void Row(uint16_t* values, 
+        uint16_t count, 
+        uint32_t x, 
+        uint32_t stepX, 
+        uint32_t y);
+
+    static void Row(uint16_t* values,
+        uint16_t count,
+        uint32_t x,
+        uint32_t stepX,
+        uint32_t y,
+        uint32_t z);
+
+private:
+    // the noise across one cell for a fixed y and z, as a function of the 
+    // x fraction f and its fade u, all Q14: Base + Slope * f + (Delta + DeltaSlope * f) * u
+    struct CellRow
+    {
+        int32_t Base;
+        int32_t Slope;
+        int32_t Delta;
+        int32_t DeltaSlope;
+    };
+
+    static uint8_t hash(uint8_t index);
+    static int32_t fade(int32_t fraction);
+    static void addCorners(CellRow* cell,
+        int32_t weight,
+        uint8_t hash0,
+        uint8_t hash1,
+        int32_t fractionY,
+        int32_t fractionZ,
+        bool threeD);
+    static void evaluateRow(uint16_t* values,
+        uint16_t count,
+        uint32_t x,
+        uint32_t stepX,
+        uint32_t y,
+        uint32_t z,
+        bool threeD);
+};
@@ -0,0 +1,202 @@
+/*-------------------------------------------------------------------------
+NeoNoiseEffects renders fire, plasma and blended noise effects
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoNoiseEffects renders procedural effects built on NeoNoise straight into
+// the pixels of a NeoBufferContext, a row at a time through a topology like
+// NeoTopology, NeoTiles or NeoMosaic.
+// Each effect takes a time that moves the noise field, in noise units where
+// 0x10000 is one cell, so the rate is up to the sketch, like millis() * 32.
+//     Plasma - the noise picks the hue
+//     Fire - the noise rises from the bottom row and cools as it goes up
+//     Blend - the noise blends between two colors, like clouds or lava
+//
+template <typename T_COLOR_FEATURE> class NeoNoiseEffects
+{
+public:
+    typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+
+    // ------------------------------------------------------------------------
+    // width - the widest topology that will be rendered
+    // ------------------------------------------------------------------------
+    NeoNoiseEffects(uint16_t width) :
+        _width(width),
+        _scale(0x2000)
+    {
+        _row = new uint16_t[width];
+        _detail = new uint16_t[width];
+    }
+
+    ~NeoNoiseEffects()
+    {
+        delete[] _row;
+        delete[] _detail;
+    }
+
+    // ------------------------------------------------------------------------
+    // SetScale sets the noise cells per pixel as 16.16 fixed point, smaller
+    // is smoother; the default 0x2000 is one cell every 8 pixels
+    // ------------------------------------------------------------------------
+    void SetScale(uint32_t scale)
+    {
+        _scale = scale;
+    }
+
+    template <typename T_TOPOLOGY> void Plasma(NeoBufferContext<T_COLOR_FEATURE> buffer,
+        const T_TOPOLOGY& topology,
+        uint32_t time,
+        uint8_t brightness = 255)
+    {
+        uint16_t width = rowWidth(topology);
+        uint16_t height = topology.getHeight();
+        // the hue also turns slowly so every color is seen
+        uint16_t hueShift = time >> 6;
+
+        for (uint16_t y = 0; y < height; y++)
+        {
+            NeoNoise::Row(_row, width, 0, _scale, y * _scale, time);
+
+            for (uint16_t x = 0; x < width; x++)
+            {
+                // noise rarely reaches its ends, so widen it to cycle the hues 
+                uint16_t hue = (_row[x] << 1) + hueShift;
+                RgbColor color(Hsb32Color(hue, 255, brightness));
+
+                apply(buffer, topology.MapProbe(x, y), ColorObject(color));
+            }
+        }
+    }
+
+    template <typename T_TOPOLOGY> void Fire(NeoBufferContext<T_COLOR_FEATURE> buffer,
+        const T_TOPOLOGY& topology,
+        uint32_t time)
+    {
+        uint16_t width = rowWidth(topology);
+        uint16_t height = topology.getHeight();
+
+        for (uint16_t y = 0; y < height; y++)
+        {
+            // the field scrolls up while it also changes
+            uint32_t noiseY = y * _scale + time;
+
+            NeoNoise::Row(_row, width, 0, _scale, noiseY, time >> 2);
+            NeoNoise::Row(_detail, width, 0x800000, _scale * 2, noiseY * 2, time >> 1);
+
+            // cooling from full heat at the bottom, quickly toward the top
+            uint32_t rowHeat = (static_cast<uint32_t>(y + 1) << 16) / height;
+
+            rowHeat = ((rowHeat >> 1) * (rowHeat >> 1)) >> 14;
+
+            for (uint16_t x = 0; x < width; x++)
+            {
+                uint32_t noise = _row[x] + (_detail[x] >> 1);
+                uint32_t heat = (noise > 0xffff) ? 0xffff : noise;
+
+                heat = (heat * rowHeat) >> 16;
+                apply(buffer, topology.MapProbe(x, y), ColorObject(heatColor(heat)));
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Blend blends from colorLow to colorHigh by the noise, detail adds a 
+    // second finer noise for rougher edges, like clouds
+    // ------------------------------------------------------------------------
+    template <typename T_TOPOLOGY> void Blend(NeoBufferContext<T_COLOR_FEATURE> buffer,
+        const T_TOPOLOGY& topology,
+        uint32_t time,
+        const ColorObject& colorLow,
+        const ColorObject& colorHigh,
+        bool detail = false)
+    {
+        uint16_t width = rowWidth(topology);
+        uint16_t height = topology.getHeight();
+
+        for (uint16_t y = 0; y < height; y++)
+        {
+            NeoNoise::Row(_row, width, 0, _scale, y * _scale, time);
+            if (detail)
+            {
+                NeoNoise::Row(_detail, width, 0x800000, _scale * 2, y * _scale * 2, time * 2);
+            }
+
+            for (uint16_t x = 0; x < width; x++)
+            {
+                uint16_t noise = _row[x];
+
+                if (detail)
+                {
+                    // two thirds coarse and a third fine
+                    noise = (static_cast<uint32_t>(noise) * 2 + _detail[x]) / 3;
+                }
+
+                apply(buffer, 
+                    topology.MapProbe(x, y), 
+                    ColorObject::LinearBlend(colorLow, colorHigh, NeoProgress16(noise)));
+            }
+        }
+    }
+
+private:
+    const uint16_t _width;
+    uint32_t _scale;
+    uint16_t* _row;
+    uint16_t* _detail;
+
+    template <typename T_TOPOLOGY> uint16_t rowWidth(const T_TOPOLOGY& topology) const
+    {
+        uint16_t width = topology.getWidth();
+
+        return (width < _width) ? width : _width;
+    }
+
+    static void apply(NeoBufferContext<T_COLOR_FEATURE>& buffer, 
+        uint16_t indexPixel, 
+        const ColorObject& color)
+    {
+        if (indexPixel < buffer.PixelCount())
+        {
+            T_COLOR_FEATURE::applyPixelColor(buffer.Pixels, indexPixel, color);
+        }
+    }
+
+    // black to red to yellow to white
+    static RgbColor heatColor(uint32_t heat)
+    {
+        uint32_t heat3 = heat * 3;
+        uint8_t ramp = (heat3 & 0xffff) >> 8;
+
+        switch (heat3 >> 16)
+        {
+        case 0:
+            return RgbColor(ramp, 0, 0);
+        case 1:
+            return RgbColor(255, ramp, 0);
+        default:
+            return RgbColor(255, 255, ramp);
+        }
+    }
+};
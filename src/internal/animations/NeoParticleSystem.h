@@ -0,0 +1,411 @@
+/*-------------------------------------------------------------------------
+NeoParticleSystem is a fixed point particle engine that renders into
+NeoBuffers and NeoDibs
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+enum NeoParticleBlend
+{
+    NeoParticleBlend_Add,   // adds to the pixel, limited to the color Max
+    NeoParticleBlend_Max    // keeps the brighter of each element
+};
+
+// NeoParticleSystem holds a fixed size pool of particles, each with a 
+// position, velocity, color and life, stored as parallel arrays (structure of
+// arrays) so the update and render passes stream through memory.
+// Positions and velocities are 16.16 fixed point pixels, PixelUnit is one
+// pixel, so there is no floating point math per particle.
+// Live particles are kept packed at the front of the pool, a particle that
+// dies is replaced by the last one, so the passes only touch live particles.
+//
+// Each Update moves the particles by their velocity, adds gravity to the
+// velocity and ages them; a particle fades out with its remaining life and
+// dies when its life is over or it leaves the bounds.
+// Render draws each particle into the nearest pixel, as a strip using the x
+// position or through a topology like NeoTopology, NeoTiles or NeoMosaic;
+// Decay dims the whole buffer first when trails are wanted.
+//
+template <typename T_COLOR_FEATURE> class NeoParticleSystem
+{
+public:
+    typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+
+    static const int32_t PixelUnit = 0x10000;
+
+    NeoParticleSystem(uint16_t countParticles) :
+        _countParticles(countParticles),
+        _activeParticles(0),
+        _gravityX(0),
+        _gravityY(0),
+        _boundsWidth(0),
+        _boundsHeight(0)
+    {
+        _positionX = new int32_t[countParticles];
+        _positionY = new int32_t[countParticles];
+        _velocityX = new int32_t[countParticles];
+        _velocityY = new int32_t[countParticles];
+        _color = new ColorObject[countParticles];
+        _life = new uint16_t[countParticles];
+        _lifeStep = new uint16_t[countParticles];
+    }
+
+    ~NeoParticleSystem()
+    {
+        delete[] _positionX;
+        delete[] _positionY;
+        delete[] _velocityX;
+        delete[] _velocityY;
+        delete[] _color;
+        delete[] _life;
+        delete[] _lifeStep;
+    }
+
+    // ------------------------------------------------------------------------
+    // Emit adds a particle, returning false if the pool is full
+    // x, y - position in PixelUnit, y is ignored when rendered as a strip
+    // velocityX, velocityY - PixelUnit per tick, a tick is the unit of the
+    //     elapsed time given to Update, like milliseconds or frames
+    // color - the color at full life
+    // lifeTicks - ticks until the particle has faded out and dies
+    // ------------------------------------------------------------------------
+    bool Emit(int32_t x,
+        int32_t y,
+        int32_t velocityX,
+        int32_t velocityY,
+        const ColorObject& color,
+        uint16_t lifeTicks)
+    {
+        if (_activeParticles >= _countParticles)
+        {
+            return false;
+        }
+
+        uint16_t particle = _activeParticles++;
+
+        _positionX[particle] = x;
+        _positionY[particle] = y;
+        _velocityX[particle] = velocityX;
+        _velocityY[particle] = velocityY;
+        _color[particle] = color;
+        _life[particle] = NeoProgress16::Max;
+        // rounded up so the particle dies after lifeTicks
+        _lifeStep[particle] = (lifeTicks > 1) ?
+            (NeoProgress16::Max + lifeTicks - 1) / lifeTicks :
+            NeoProgress16::Max;
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // SetGravity sets the change in velocity per tick, in PixelUnit
+    // ------------------------------------------------------------------------
+    void SetGravity(int32_t gravityX, int32_t gravityY)
+    {
+        _gravityX = gravityX;
+        _gravityY = gravityY;
+    }
+
+    // ------------------------------------------------------------------------
+    // SetBounds removes particles that leave the area from 0,0 to width,height
+    // in pixels, zero does not bound that direction
+    // ------------------------------------------------------------------------
+    void SetBounds(uint16_t width, uint16_t height = 0)
+    {
+        _boundsWidth = width;
+        _boundsHeight = height;
+    }
+
+    void Clear()
+    {
+        _activeParticles = 0;
+    }
+
+    uint16_t ActiveCount() const
+    {
+        return _activeParticles;
+    }
+
+    uint16_t Capacity() const
+    {
+        return _countParticles;
+    }
+
+    // ------------------------------------------------------------------------
+    // Update moves and ages all particles by elapsed ticks
+    // ------------------------------------------------------------------------
+    void Update(uint16_t elapsed = 1)
+    {
+        const int32_t gravityX = _gravityX * elapsed;
+        const int32_t gravityY = _gravityY * elapsed;
+        const int32_t limitX = static_cast<int32_t>(_boundsWidth) << 16;
+        const int32_t limitY = static_cast<int32_t>(_boundsHeight) << 16;
+        uint16_t particle = 0;
+
+        while (particle < _activeParticles)
+        {
+            uint32_t age = static_cast<uint32_t>(_lifeStep[particle]) * elapsed;
+
+            if (age < _life[particle])
+            {
+                _life[particle] -= age;
+
+                int32_t velocityX = _velocityX[particle] + gravityX;
+                int32_t velocityY = _velocityY[particle] + gravityY;
+                int32_t x = _positionX[particle] + velocityX * elapsed;
+                int32_t y = _positionY[particle] + velocityY * elapsed;
+
+                _velocityX[particle] = velocityX;
+                _velocityY[particle] = velocityY;
+                _positionX[particle] = x;
+                _positionY[particle] = y;
+
+                if (!((limitX && (x < 0 || x >= limitX)) ||
+                    (limitY && (y < 0 || y >= limitY))))
+                {
+                    particle++;
+                    continue;
+                }
+            }
+
+            remove(particle);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Render draws all particles into a buffer, like a NeoBuffer, 
+    // NeoPixelBus or NeoDib, as a strip by x or through topology
+    // ------------------------------------------------------------------------
+    void Render(NeoBufferContext<T_COLOR_FEATURE> buffer, 
+        NeoParticleBlend blend = NeoParticleBlend_Add)
+    {
+        FeatureTarget target(buffer.Pixels);
+
+        render(target, buffer.PixelCount(), StripMap(), blend);
+    }
+
+    template <typename T_TOPOLOGY> void Render(NeoBufferContext<T_COLOR_FEATURE> buffer,
+        const T_TOPOLOGY& topology,
+        NeoParticleBlend blend = NeoParticleBlend_Add)
+    {
+        FeatureTarget target(buffer.Pixels);
+
+        render(target, buffer.PixelCount(), topology, blend);
+    }
+
+    void Render(NeoDib<ColorObject>& dib, 
+        NeoParticleBlend blend = NeoParticleBlend_Add)
+    {
+        DibTarget target(dib.Pixels());
+
+        render(target, dib.PixelCount(), StripMap(), blend);
+        dib.Dirty();
+    }
+
+    template <typename T_TOPOLOGY> void Render(NeoDib<ColorObject>& dib,
+        const T_TOPOLOGY& topology,
+        NeoParticleBlend blend = NeoParticleBlend_Add)
+    {
+        DibTarget target(dib.Pixels());
+
+        render(target, dib.PixelCount(), topology, blend);
+        dib.Dirty();
+    }
+
+    // ------------------------------------------------------------------------
+    // Decay dims every pixel of the buffer by ratio, 0 is black and 255 
+    // keeps all, call it before Render to leave fading trails
+    // ------------------------------------------------------------------------
+    static void Decay(NeoBufferContext<T_COLOR_FEATURE> buffer, uint8_t ratio)
+    {
+        // always through the feature, as encoded features like Lpd8806 and
+        // DotStar have bits in their pixel bytes that must not be scaled
+        const uint32_t weight = decayWeight(ratio);
+        uint16_t countPixels = buffer.PixelCount();
+
+        for (uint16_t indexPixel = 0; indexPixel < countPixels; indexPixel++)
+        {
+            T_COLOR_FEATURE::applyPixelColor(buffer.Pixels, 
+                indexPixel,
+                scale(T_COLOR_FEATURE::retrievePixelColor(buffer.Pixels, indexPixel), weight));
+        }
+    }
+
+    static void Decay(NeoDib<ColorObject>& dib, uint8_t ratio)
+    {
+        const uint32_t weight = decayWeight(ratio);
+        ColorObject* pixels = dib.Pixels();
+        uint16_t countPixels = dib.PixelCount();
+
+        for (uint16_t indexPixel = 0; indexPixel < countPixels; indexPixel++)
+        {
+            pixels[indexPixel] = scale(pixels[indexPixel], weight);
+        }
+        dib.Dirty();
+    }
+
+private:
+    const uint16_t _countParticles;
+    uint16_t _activeParticles;
+    int32_t _gravityX;
+    int32_t _gravityY;
+    uint16_t _boundsWidth;
+    uint16_t _boundsHeight;
+
+    int32_t* _positionX;
+    int32_t* _positionY;
+    int32_t* _velocityX;
+    int32_t* _velocityY;
+    ColorObject* _color;
+    uint16_t* _life; // NeoProgress16 value, the brightness
+    uint16_t* _lifeStep;
+
+    // maps x to the index along a strip
+    struct StripMap
+    {
+        uint16_t MapProbe(int16_t x, int16_t) const
+        {
+            return (x < 0) ? PixelIndex_OutOfBounds : x;
+        }
+    };
+
+    struct FeatureTarget
+    {
+        FeatureTarget(uint8_t* pixels) :
+            Pixels(pixels)
+        {
+        }
+
+        ColorObject Get(uint16_t indexPixel) const
+        {
+            return T_COLOR_FEATURE::retrievePixelColor(Pixels, indexPixel);
+        }
+
+        void Set(uint16_t indexPixel, const ColorObject& color)
+        {
+            T_COLOR_FEATURE::applyPixelColor(Pixels, indexPixel, color);
+        }
+
+        uint8_t* Pixels;
+    };
+
+    struct DibTarget
+    {
+        DibTarget(ColorObject* pixels) :
+            Pixels(pixels)
+        {
+        }
+
+        ColorObject Get(uint16_t indexPixel) const
+        {
+            return Pixels[indexPixel];
+        }
+
+        void Set(uint16_t indexPixel, const ColorObject& color)
+        {
+            Pixels[indexPixel] = color;
+        }
+
+        ColorObject* Pixels;
+    };
+
+    template <typename T_TARGET, typename T_MAP> void render(T_TARGET& target,
+        uint16_t countPixels,
+        const T_MAP& map,
+        NeoParticleBlend blend)
+    {
+        for (uint16_t particle = 0; particle < _activeParticles; particle++)
+        {
+            // nearest pixel, skipping what can't be a 16 bit coordinate
+            int32_t x = (_positionX[particle] + 0x8000) >> 16;
+            int32_t y = (_positionY[particle] + 0x8000) >> 16;
+
+            if (x < -0x8000 || x > 0x7fff || y < -0x8000 || y > 0x7fff)
+            {
+                continue;
+            }
+
+            uint16_t indexPixel = map.MapProbe(x, y);
+
+            if (indexPixel >= countPixels)
+            {
+                continue;
+            }
+
+            uint16_t life = _life[particle];
+            ColorObject color = scale(_color[particle], life + (life >> 15));
+            ColorObject existing = target.Get(indexPixel);
+
+            for (size_t element = 0; element < ColorObject::Count; element++)
+            {
+                uint32_t value = color[element];
+
+                if (blend == NeoParticleBlend_Add)
+                {
+                    value += existing[element];
+                    if (value > ColorObject::Max)
+                    {
+                        value = ColorObject::Max;
+                    }
+                }
+                else if (value < existing[element])
+                {
+                    value = existing[element];
+                }
+                color[element] = value;
+            }
+
+            target.Set(indexPixel, color);
+        }
+    }
+
+    // weight is 0 to 65536
+    // the weight of scale for a Decay ratio, 0 is black even for the 16 bit
+    // elements and 255 keeps all
+    static uint32_t decayWeight(uint8_t ratio)
+    {
+        return (ratio == 0) ? 0 : (static_cast<uint32_t>(ratio) + 1) << 8;
+    }
+
+    static ColorObject scale(ColorObject color, uint32_t weight)
+    {
+        for (size_t element = 0; element < ColorObject::Count; element++)
+        {
+            color[element] = (color[element] * weight) >> 16;
+        }
+        return color;
+    }
+
+    void remove(uint16_t particle)
+    {
+        uint16_t last = --_activeParticles;
+
+        _positionX[particle] = _positionX[last];
+        _positionY[particle] = _positionY[last];
+        _velocityX[particle] = _velocityX[last];
+        _velocityY[particle] = _velocityY[last];
+        _color[particle] = _color[last];
+        _life[particle] = _life[last];
+        _lifeStep[particle] = _lifeStep[last];
+    }
+};
@@ -28,14 +28,24 @@ License along with NeoPixel.  If not, see
 #include "../NeoUtil.h"
 #include "NeoPixelAnimator.h"
 
-NeoPixelAnimator::NeoPixelAnimator(uint16_t countAnimations, uint16_t timeScale) :
+NeoPixelAnimator::NeoPixelAnimator(uint16_t countAnimations, 
+        uint16_t timeScale,
+        AnimClockFunction clock) :
     _countAnimations(countAnimations),
+    _activeHead(IndexNone),
+    _activeTail(IndexNone),
+    _freeHead(IndexNone),
+    _updateNext(IndexNone),
+    _updateEnd(IndexNone),
+    _clock(clock),
     _animationLastTick(0),
     _activeAnimations(0),
-    _isRunning(true)
+    _isRunning(true),
+    _isUpdating(false)
 {
     setTimeScale(timeScale);
     _animations = new AnimationContext[_countAnimations];
+    resetLists();
 }
 
 NeoPixelAnimator::~NeoPixelAnimator()
@@ -45,6 +55,19 @@ NeoPixelAnimator::~NeoPixelAnimator()
 
 bool NeoPixelAnimator::NextAvailableAnimation(uint16_t* indexAvailable, uint16_t indexStart)
 {
+    if (indexStart == 0)
+    {
+        if (_freeHead == IndexNone)
+        {
+            return false;
+        }
+        if (indexAvailable)
+        {
+            *indexAvailable = _freeHead;
+        }
+        return true;
+    }
+
     if (indexStart >= _countAnimations)
     {
         // last one
@@ -69,7 +92,7 @@ bool NeoPixelAnimator::NextAvailableAnimation(uint16_t* indexAvailable, uint16_t
 }
 
 void NeoPixelAnimator::StartAnimation(uint16_t indexAnimation, 
-        uint16_t duration, 
+        uint32_t duration, 
         AnimUpdateCallback animUpdate)
 {
     if (indexAnimation >= _countAnimations || animUpdate == NULL)
@@ -79,7 +102,7 @@ void NeoPixelAnimator::StartAnimation(uint16_t indexAnimation,
 
     if (_activeAnimations == 0)
     {
-        _animationLastTick = millis();
+        _animationLastTick = _clock();
     }
 
     StopAnimation(indexAnimation);
@@ -93,6 +116,8 @@ void NeoPixelAnimator::StartAnimation(uint16_t indexAnimation,
 
     _animations[indexAnimation].StartAnimation(duration, animUpdate);
 
+    listRemove(&_freeHead, nullptr, indexAnimation);
+    listAppend(indexAnimation);
     _activeAnimations++;
 }
 
@@ -107,6 +132,9 @@ void NeoPixelAnimator::StopAnimation(uint16_t indexAnimation)
     {
         _activeAnimations--;
         _animations[indexAnimation].StopAnimation();
+
+        listRemove(&_activeHead, &_activeTail, indexAnimation);
+        listInsertFree(indexAnimation);
     }
 }
 
@@ -117,6 +145,7 @@ void NeoPixelAnimator::StopAll()
         _animations[indexAnimation].StopAnimation();
     }
     _activeAnimations = 0;
+    resetLists();
 }
 
 
@@ -124,7 +153,7 @@ void NeoPixelAnimator::UpdateAnimations()
 {
     if (_isRunning)
     {
-        uint32_t currentTick = millis();
+        uint32_t currentTick = _clock();
         uint32_t delta = currentTick - _animationLastTick;
 
         if (delta >= _timeScale)
@@ -133,9 +162,24 @@ void NeoPixelAnimator::UpdateAnimations()
 
             delta /= _timeScale; // scale delta into animation time
 
-            for (uint16_t iAnim = 0; iAnim < _countAnimations; iAnim++)
+            // keep the fraction of a tick for the next update so coarse time
+            // scales do not drift
+            _animationLastTick += delta * _timeScale;
+
+            // only the active list is walked, in the order the animations 
+            // were started; callbacks may start and stop animations, 
+            // stopping keeps _updateNext valid and the ones started from
+            // _updateEnd on are not updated until the next tick
+            _updateNext = _activeHead;
+            _updateEnd = IndexNone;
+            _isUpdating = true;
+            while (_updateNext != IndexNone && _updateNext != _updateEnd)
             {
+                uint16_t iAnim = _updateNext;
+
                 pAnim = &_animations[iAnim];
+                _updateNext = pAnim->_next;
+
                 AnimUpdateCallback fnUpdate = pAnim->_fnCallback;
                 AnimationParam param;
                 
@@ -144,30 +188,38 @@ void NeoPixelAnimator::UpdateAnimations()
                 if (pAnim->_remaining > delta)
                 {
                     param.state = (pAnim->_remaining == pAnim->_duration) ? AnimationState_Started : AnimationState_Progress;
-                    param.progress = pAnim->CurrentProgress();
+                    param.progress16 = pAnim->CurrentProgress();
+                    param.progress = param.progress16.ToFloat();
 
                     fnUpdate(param);
 
-                    pAnim->_remaining -= delta;
+                    // the callback may have stopped or restarted it
+                    if (pAnim->_remaining > delta)
+                    {
+                        pAnim->_remaining -= delta;
+                    }
+                    else if (pAnim->_remaining > 0)
+                    {
+                        pAnim->_remaining = 1;
+                    }
                 }
                 else if (pAnim->_remaining > 0)
                 {
                     param.state = AnimationState_Completed;
+                    param.progress16 = NeoProgress16(NeoProgress16::Max);
                     param.progress = 1.0f;
 
-                    _activeAnimations--; 
-                    pAnim->StopAnimation();
+                    StopAnimation(iAnim);
 
                     fnUpdate(param);
                 }
             }
-
-            _animationLastTick = currentTick;
+            _isUpdating = false;
         }
     }
 }
 
-void NeoPixelAnimator::ChangeAnimationDuration(uint16_t indexAnimation, uint16_t newDuration)
+void NeoPixelAnimator::ChangeAnimationDuration(uint16_t indexAnimation, uint32_t newDuration)
 {
     if (indexAnimation >= _countAnimations)
     {
@@ -176,23 +228,127 @@ void NeoPixelAnimator::ChangeAnimationDuration(uint16_t indexAnimation, uint16_t
 
     AnimationContext* pAnim = &_animations[indexAnimation];
 
-    // calc the current animation progress 
-    float progress = pAnim->CurrentProgress();
+    // _remaining time must also be reset after a duration change; 
+    // keep the same progress by scaling it to the new duration
+    if (pAnim->_remaining != 0)
+    {
+        // an active animation keeps a non zero duration and remaining time
+        // so it stays in the active list until it completes
+        if (newDuration == 0)
+        {
+            newDuration = 1;
+        }
+        pAnim->_remaining = newDuration - pAnim->CurrentProgress().Scale(newDuration);
+        if (pAnim->_remaining == 0)
+        {
+            pAnim->_remaining = 1;
+        }
+    }
+
+    // change the duration 
+    pAnim->_duration = newDuration;
+}
+
+void NeoPixelAnimator::listRemove(uint16_t* head, uint16_t* tail, uint16_t indexAnimation)
+{
+    AnimationContext* pAnim = &_animations[indexAnimation];
+
+    if (indexAnimation == _updateNext)
+    {
+        _updateNext = pAnim->_next;
+    }
+    if (indexAnimation == _updateEnd)
+    {
+        _updateEnd = pAnim->_next;
+    }
 
-    // keep progress in range just in case
-    if (progress < 0.0f)
+    if (pAnim->_prev != IndexNone)
     {
-        progress = 0.0f;
+        _animations[pAnim->_prev]._next = pAnim->_next;
     }
-    else if (progress > 1.0f)
+    else
     {
-        progress = 1.0f;
+        *head = pAnim->_next;
     }
 
-    // change the duration 
-    pAnim->_duration = newDuration;
-          
-    // _remaining time must also be reset after a duration change; 
-    // use the progress to recalculate it
-    pAnim->_remaining = uint16_t(pAnim->_duration * (1.0f - progress));
-}
\ No newline at end of file
+    if (pAnim->_next != IndexNone)
+    {
+        _animations[pAnim->_next]._prev = pAnim->_prev;
+    }
+    else if (tail != nullptr)
+    {
+        *tail = pAnim->_prev;
+    }
+
+    pAnim->_prev = IndexNone;
+    pAnim->_next = IndexNone;
+}
+
+void NeoPixelAnimator::listAppend(uint16_t indexAnimation)
+{
+    AnimationContext* pAnim = &_animations[indexAnimation];
+
+    pAnim->_prev = _activeTail;
+    pAnim->_next = IndexNone;
+    if (_activeTail != IndexNone)
+    {
+        _animations[_activeTail]._next = indexAnimation;
+    }
+    else
+    {
+        _activeHead = indexAnimation;
+    }
+    _activeTail = indexAnimation;
+
+    if (_isUpdating && _updateEnd == IndexNone)
+    {
+        _updateEnd = indexAnimation;
+    }
+}
+
+void NeoPixelAnimator::listInsertFree(uint16_t indexAnimation)
+{
+    AnimationContext* pAnim = &_animations[indexAnimation];
+    uint16_t prev = IndexNone;
+    uint16_t next = _freeHead;
+
+    // kept in index order so the head is the lowest free animation
+    while (next != IndexNone && next < indexAnimation)
+    {
+        prev = next;
+        next = _animations[next]._next;
+    }
+
+    pAnim->_prev = prev;
+    pAnim->_next = next;
+    if (prev != IndexNone)
+    {
+        _animations[prev]._next = indexAnimation;
+    }
+    else
+    {
+        _freeHead = indexAnimation;
+    }
+    if (next != IndexNone)
+    {
+        _animations[next]._prev = indexAnimation;
+    }
+}
+
+void NeoPixelAnimator::resetLists()
+{
+    _activeHead = IndexNone;
+    _activeTail = IndexNone;
+    _freeHead = (_countAnimations > 0) ? 0 : IndexNone;
+    _updateNext = IndexNone;
+    _updateEnd = IndexNone;
+
+    // all animations are free, in index order
+    for (uint16_t indexAnimation = 0; indexAnimation < _countAnimations; indexAnimation++)
+    {
+        AnimationContext* pAnim = &_animations[indexAnimation];
+
+        pAnim->_prev = (indexAnimation > 0) ? indexAnimation - 1 : IndexNone;
+        pAnim->_next = (indexAnimation + 1 < _countAnimations) ? indexAnimation + 1 : IndexNone;
+    }
+}
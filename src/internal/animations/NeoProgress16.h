@@ -0,0 +1,151 @@
+/*-------------------------------------------------------------------------
+NeoProgress16 provides a 16 bit unit value for animation progress and blends
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoProgress16 is a unit value (0.0 - 1.0) stored as a 16 bit fraction
+// (0 - 65535) so progress, easing and blending can be done without floating
+// point math; on platforms without a floating point unit like AVR and 
+// Esp8266 this avoids the soft float library calls on every update
+//
+struct NeoProgress16
+{
+    // ------------------------------------------------------------------------
+    // Construct a NeoProgress16 using a 16 bit fraction (0 - 65535) where
+    // 0 is 0.0 and 65535 is 1.0
+    // ------------------------------------------------------------------------
+    constexpr NeoProgress16() :
+        Value(0)
+    {
+    };
+
+    explicit constexpr NeoProgress16(uint16_t value) :
+        Value(value)
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // FromFloat creates a NeoProgress16 from a unit value (0.0 - 1.0), 
+    // values outside of the range are clamped
+    // ------------------------------------------------------------------------
+    static NeoProgress16 FromFloat(float unitValue)
+    {
+        if (unitValue <= 0.0f)
+        {
+            return NeoProgress16(0);
+        }
+        if (unitValue >= 1.0f)
+        {
+            return NeoProgress16(Max);
+        }
+        return NeoProgress16(static_cast<uint16_t>(unitValue * Max + 0.5f));
+    }
+
+    // ------------------------------------------------------------------------
+    // FromRatio creates a NeoProgress16 from the integer ratio of part over
+    // whole, like elapsed time over duration, where part at or above whole 
+    // is 1.0
+    // ------------------------------------------------------------------------
+    static NeoProgress16 FromRatio(uint32_t part, uint32_t whole)
+    {
+        if (part >= whole)
+        {
+            return NeoProgress16(Max);
+        }
+
+        // reduce the precision of large ratios so part * Max fits
+        while (whole > 0xffff)
+        {
+            whole >>= 1;
+            part >>= 1;
+        }
+        return NeoProgress16((part * Max + (whole >> 1)) / whole);
+    }
+
+    // ------------------------------------------------------------------------
+    // ToFloat returns the unit value (0.0 - 1.0)
+    // ------------------------------------------------------------------------
+    float ToFloat() const
+    {
+        return Value * (1.0f / Max);
+    }
+
+    // ------------------------------------------------------------------------
+    // ToByte returns the progress (0 - 255) as used by the uint8_t 
+    // LinearBlend overloads
+    // ------------------------------------------------------------------------
+    uint8_t ToByte() const
+    {
+        return Value >> 8;
+    }
+
+    // ------------------------------------------------------------------------
+    // Weight returns the progress as a weight (0 - 65536) so that 1.0 is 
+    // exactly a shift by 16
+    // ------------------------------------------------------------------------
+    uint32_t Weight() const
+    {
+        return static_cast<uint32_t>(Value) + (Value >> 15);
+    }
+
+    // ------------------------------------------------------------------------
+    // Lerp blends two elements (0 - 65535) by this progress, 0.0 returns left
+    // and 1.0 returns right
+    // ------------------------------------------------------------------------
+    uint16_t Lerp(uint16_t left, uint16_t right) const
+    {
+        uint32_t weight = Weight();
+
+        return (left * (0x10000 - weight) + right * weight + 0x8000) >> 16;
+    }
+
+    // ------------------------------------------------------------------------
+    // Scale returns value multiplied by this progress, 0.0 returns 0 and 
+    // 1.0 returns value
+    // ------------------------------------------------------------------------
+    uint32_t Scale(uint32_t value) const
+    {
+        uint32_t weight = Weight();
+
+        return (value >> 16) * weight + (((value & 0xffff) * weight) >> 16);
+    }
+
+    bool operator==(const NeoProgress16& other) const
+    {
+        return (Value == other.Value);
+    };
+
+    bool operator!=(const NeoProgress16& other) const
+    {
+        return !(*this == other);
+    };
+
+    // ------------------------------------------------------------------------
+    // Value (0 - 65535) where 0 is 0.0 and 65535 is 1.0
+    // ------------------------------------------------------------------------
+    uint16_t Value;
+
+    const static uint16_t Max = 65535;
+};
@@ -0,0 +1,338 @@
+/*-------------------------------------------------------------------------
+NeoTimeline provides keyframed tracks of colors, positions and values
+that are evaluated together into a buffer
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+enum NeoTimelineTrackKind
+{
+    NeoTimelineTrackKind_Color,     // blends key colors into one pixel
+    NeoTimelineTrackKind_Position,  // moves a key colored dot along the strip
+    NeoTimelineTrackKind_Scalar     // blends key values, read with TrackValue()
+};
+
+const uint16_t NeoTimeline_NoTrack = 0xffff;
+
+// NeoTimeline holds tracks of keyframes and evaluates all of them in a single
+// pass per frame straight into the pixels of a NeoBufferContext.
+// The tracks and keys are stored as parallel arrays (structure of arrays) and
+// the eases are plain NeoEase16 functions, so there is no per track object, 
+// virtual or std::function dispatch and no floating point math.
+//
+// Keys are added to the most recently added track and must be added in time
+// order; each key has a time, a value and a color:
+//     Color tracks use the color and write it to their pixel
+//     Position tracks use the value as the pixel position in 1/256 of a pixel 
+//         and draw the color there, shared between the two nearest pixels
+//     Scalar tracks use the value and only store it for TrackValue()
+// Before its first key a track holds the first key, after its last key it 
+// holds the last key; tracks are applied in the order they were added.
+//
+template <typename T_COLOR_FEATURE> class NeoTimeline
+{
+public:
+    typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+    typedef NeoProgress16(*EaseFunction)(NeoProgress16 unitValue);
+
+    NeoTimeline(uint16_t countTracks, uint16_t countKeys) :
+        _countTracks(countTracks),
+        _countKeys(countKeys),
+        _usedTracks(0),
+        _usedKeys(0),
+        _loopDuration(0)
+    {
+        _trackKind = new uint8_t[countTracks];
+        _trackPixel = new uint16_t[countTracks];
+        _trackEase = new EaseFunction[countTracks];
+        _trackFirstKey = new uint16_t[countTracks];
+        _trackKeyCount = new uint16_t[countTracks];
+        _trackCursor = new uint16_t[countTracks];
+        _trackValue = new uint32_t[countTracks];
+
+        _keyTime = new uint32_t[countKeys];
+        _keyValue = new uint32_t[countKeys];
+        _keyColor = new ColorObject[countKeys];
+    }
+
+    ~NeoTimeline()
+    {
+        delete[] _trackKind;
+        delete[] _trackPixel;
+        delete[] _trackEase;
+        delete[] _trackFirstKey;
+        delete[] _trackKeyCount;
+        delete[] _trackCursor;
+        delete[] _trackValue;
+
+        delete[] _keyTime;
+        delete[] _keyValue;
+        delete[] _keyColor;
+    }
+
+    // ------------------------------------------------------------------------
+    // AddColorTrack, AddPositionTrack and AddScalarTrack add a track and 
+    // return its index, or NeoTimeline_NoTrack if all tracks are used
+    // indexPixel - the pixel a color track writes
+    // ease - the NeoEase16 curve applied between each pair of keys
+    // ------------------------------------------------------------------------
+    uint16_t AddColorTrack(uint16_t indexPixel, EaseFunction ease = NeoEase16::Linear)
+    {
+        return addTrack(NeoTimelineTrackKind_Color, indexPixel, ease);
+    }
+
+    uint16_t AddPositionTrack(EaseFunction ease = NeoEase16::Linear)
+    {
+        return addTrack(NeoTimelineTrackKind_Position, 0, ease);
+    }
+
+    uint16_t AddScalarTrack(EaseFunction ease = NeoEase16::Linear)
+    {
+        return addTrack(NeoTimelineTrackKind_Scalar, 0, ease);
+    }
+
+    // ------------------------------------------------------------------------
+    // AddKey adds a key to the most recently added track, returning false if
+    // all keys are used, there is no track, or time is before the last key
+    // ------------------------------------------------------------------------
+    bool AddKey(uint32_t time, const ColorObject& color)
+    {
+        return AddKey(time, 0, color);
+    }
+
+    bool AddKey(uint32_t time, uint32_t value, const ColorObject& color = ColorObject(0))
+    {
+        if (_usedTracks == 0 || _usedKeys >= _countKeys)
+        {
+            return false;
+        }
+
+        uint16_t indexTrack = _usedTracks - 1;
+
+        if (_trackKeyCount[indexTrack] && time < _keyTime[_usedKeys - 1])
+        {
+            return false;
+        }
+
+        _keyTime[_usedKeys] = time;
+        _keyValue[_usedKeys] = value;
+        _keyColor[_usedKeys] = color;
+        _usedKeys++;
+        _trackKeyCount[indexTrack]++;
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // Clear removes all tracks and keys
+    // ------------------------------------------------------------------------
+    void Clear()
+    {
+        _usedTracks = 0;
+        _usedKeys = 0;
+    }
+
+    // ------------------------------------------------------------------------
+    // SetLoopDuration repeats the timeline every duration, zero does not loop
+    // ------------------------------------------------------------------------
+    void SetLoopDuration(uint32_t duration)
+    {
+        _loopDuration = duration;
+    }
+
+    uint16_t TrackCount() const
+    {
+        return _usedTracks;
+    }
+
+    // ------------------------------------------------------------------------
+    // TrackValue returns the value of a scalar or position track as of the 
+    // last Update
+    // ------------------------------------------------------------------------
+    uint32_t TrackValue(uint16_t indexTrack) const
+    {
+        if (indexTrack >= _usedTracks)
+        {
+            return 0;
+        }
+        return _trackValue[indexTrack];
+    }
+
+    // ------------------------------------------------------------------------
+    // Update evaluates all tracks at time and writes the color and position
+    // tracks into buffer; time is in the same units as the keys, like
+    // millis(), and may also run backwards
+    // ------------------------------------------------------------------------
+    void Update(NeoBufferContext<T_COLOR_FEATURE> buffer, uint32_t time)
+    {
+        uint16_t countPixels = buffer.PixelCount();
+
+        if (_loopDuration)
+        {
+            time %= _loopDuration;
+        }
+
+        for (uint16_t indexTrack = 0; indexTrack < _usedTracks; indexTrack++)
+        {
+            uint16_t countKeys = _trackKeyCount[indexTrack];
+
+            if (countKeys == 0)
+            {
+                continue;
+            }
+
+            uint16_t first = _trackFirstKey[indexTrack];
+            uint16_t key = first + seek(indexTrack, first, countKeys, time);
+            uint16_t next = key + 1;
+            uint32_t value = _keyValue[key];
+            ColorObject color = _keyColor[key];
+
+            if (next < first + countKeys && time > _keyTime[key])
+            {
+                NeoProgress16 progress = _trackEase[indexTrack](NeoProgress16::FromRatio(
+                    time - _keyTime[key],
+                    _keyTime[next] - _keyTime[key]));
+
+                value = lerp(value, _keyValue[next], progress);
+                if (_trackKind[indexTrack] != NeoTimelineTrackKind_Scalar)
+                {
+                    color = ColorObject::LinearBlend(color, _keyColor[next], progress);
+                }
+            }
+
+            _trackValue[indexTrack] = value;
+
+            switch (_trackKind[indexTrack])
+            {
+            case NeoTimelineTrackKind_Color:
+                if (_trackPixel[indexTrack] < countPixels)
+                {
+                    T_COLOR_FEATURE::applyPixelColor(buffer.Pixels, _trackPixel[indexTrack], color);
+                }
+                break;
+
+            case NeoTimelineTrackKind_Position:
+                drawDot(buffer.Pixels, countPixels, value, color);
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+private:
+    const uint16_t _countTracks;
+    const uint16_t _countKeys;
+    uint16_t _usedTracks;
+    uint16_t _usedKeys;
+    uint32_t _loopDuration;
+
+    // tracks
+    uint8_t* _trackKind;
+    uint16_t* _trackPixel;
+    EaseFunction* _trackEase;
+    uint16_t* _trackFirstKey;
+    uint16_t* _trackKeyCount;
+    uint16_t* _trackCursor; // the key last used, relative to the first key
+    uint32_t* _trackValue;
+
+    // keys
+    uint32_t* _keyTime;
+    uint32_t* _keyValue;
+    ColorObject* _keyColor;
+
+    uint16_t addTrack(NeoTimelineTrackKind kind, uint16_t indexPixel, EaseFunction ease)
+    {
+        if (_usedTracks >= _countTracks)
+        {
+            return NeoTimeline_NoTrack;
+        }
+
+        uint16_t indexTrack = _usedTracks++;
+
+        _trackKind[indexTrack] = kind;
+        _trackPixel[indexTrack] = indexPixel;
+        _trackEase[indexTrack] = ease;
+        _trackFirstKey[indexTrack] = _usedKeys;
+        _trackKeyCount[indexTrack] = 0;
+        _trackCursor[indexTrack] = 0;
+        _trackValue[indexTrack] = 0;
+        return indexTrack;
+    }
+
+    // finds the last key at or before time, starting at the key used by the
+    // previous update so a forward running timeline only moves a key or two
+    uint16_t seek(uint16_t indexTrack, uint16_t first, uint16_t countKeys, uint32_t time)
+    {
+        uint16_t cursor = _trackCursor[indexTrack];
+
+        if (time < _keyTime[first + cursor])
+        {
+            cursor = 0;
+        }
+        while (cursor + 1 < countKeys && _keyTime[first + cursor + 1] <= time)
+        {
+            cursor++;
+        }
+
+        _trackCursor[indexTrack] = cursor;
+        return cursor;
+    }
+
+    static uint32_t lerp(uint32_t left, uint32_t right, NeoProgress16 progress)
+    {
+        if (right >= left)
+        {
+            return left + progress.Scale(right - left);
+        }
+        return left - progress.Scale(left - right);
+    }
+
+    // draws color at position (1/256 pixel), sharing it between the two 
+    // nearest pixels by the fraction so slow moves are smooth
+    static void drawDot(uint8_t* pixels, uint16_t countPixels, uint32_t position, const ColorObject& color)
+    {
+        uint32_t indexPixel = position >> 8;
+        uint32_t fraction = position & 0xff;
+
+        if (indexPixel < countPixels)
+        {
+            ColorObject existing = T_COLOR_FEATURE::retrievePixelColor(pixels, indexPixel);
+            NeoProgress16 coverage(((256 - fraction) * NeoProgress16::Max) >> 8);
+
+            T_COLOR_FEATURE::applyPixelColor(pixels, 
+                indexPixel, 
+                ColorObject::LinearBlend(existing, color, coverage));
+        }
+        if (fraction && indexPixel + 1 < countPixels)
+        {
+            ColorObject existing = T_COLOR_FEATURE::retrievePixelColor(pixels, indexPixel + 1);
+            NeoProgress16 coverage((fraction * NeoProgress16::Max) >> 8);
+
+            T_COLOR_FEATURE::applyPixelColor(pixels,
+                indexPixel + 1,
+                ColorObject::LinearBlend(existing, color, coverage));
+        }
+    }
+};
@@ -299,6 +299,68 @@ public:
     };
 
 
+    // Blt the source rectangle scaled to fill the destination rectangle
+    // and optionally rotated and/or flipped, see NeoBltTransform
+    // NOTE: every sample seeks in the file, consider loading the 
+    // bitmap into a NeoBuffer first when it is drawn often
+    // T_BLT_FILTER - one of
+    //      NeoBltNearestFilter
+    //      NeoBltBilinearFilter
+    //
+    template <typename T_BLT_FILTER = NeoBltNearestFilter> void StretchBlt(NeoBufferContext<T_COLOR_FEATURE> destBuffer,
+        int16_t xDest,
+        int16_t yDest,
+        int16_t wDest,
+        int16_t hDest,
+        int16_t xSrc,
+        int16_t ySrc,
+        int16_t wSrc,
+        int16_t hSrc,
+        LayoutMapCallback layoutMap,
+        uint8_t transform = NeoBltTransform_None)
+    {
+        if (wDest <= 0 || hDest <= 0 || wSrc <= 0 || hSrc <= 0)
+        {
+            return;
+        }
+
+        const uint16_t destPixelCount = destBuffer.PixelCount();
+        NeoBltStepper stepper(wDest, hDest, xSrc, ySrc, wSrc, hSrc, transform);
+        int16_t xMin = constrainX(xSrc);
+        int16_t yMin = constrainY(ySrc);
+        int16_t xMax = constrainX(xSrc + wSrc - 1);
+        int16_t yMax = constrainY(ySrc + hSrc - 1);
+
+        for (int16_t y = 0; y < hDest; y++)
+        {
+            int32_t sx = stepper.RowX(y);
+            int32_t sy = stepper.RowY(y);
+
+            for (int16_t x = 0; x < wDest; x++)
+            {
+                uint16_t indexDest = layoutMap(xDest + x, yDest + y);
+
+                if (indexDest < destPixelCount)
+                {
+                    ColorObject color = T_BLT_FILTER::Sample(*this,
+                        sx,
+                        sy,
+                        xMin,
+                        yMin,
+                        xMax,
+                        yMax);
+
+                    T_COLOR_FEATURE::applyPixelColor(destBuffer.Pixels, indexDest, color);
+                }
+
+                sx += stepper.StepX();
+                sy += stepper.StepY();
+            }
+        }
+    };
+
+    typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+
 private:
     T_FILE_METHOD _file;
     uint32_t _fileAddressPixels;
@@ -0,0 +1,261 @@
+/*-------------------------------------------------------------------------
+NeoBlendSpan provides blending of whole spans of pixels in their native
+feature format
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoBlendSpan blends two buffers into a destination buffer directly on the 
+// native pixel bytes, so no color objects are created or converted. 
+// The elements are blended as independent values, so it only supports features 
+// whose pixel bytes are all color elements; features with packed elements
+// (Neo2Byte555Feature) or check bytes (P9813BgrFeature) are not supported.
+// The destination may be the same buffer as left or right.
+// OklabBlend converts through color objects to blend perceptually instead.
+//
+class NeoBlendSpan
+{
+public:
+    // ------------------------------------------------------------------------
+    // LinearBlend between all pixels of two buffers
+    // destBuffer - the buffer that receives the blend
+    // leftBuffer - the pixels to start the blend at
+    // rightBuffer - the pixels to end the blend at
+    // progress - (0 - 255) value where 0 will return left and 255 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_FEATURE> static void LinearBlend(NeoBufferContext<T_COLOR_FEATURE> destBuffer,
+        NeoBufferContext<T_COLOR_FEATURE> leftBuffer,
+        NeoBufferContext<T_COLOR_FEATURE> rightBuffer,
+        uint8_t progress)
+    {
+        uint16_t countPixels = destBuffer.PixelCount();
+
+        if (countPixels > leftBuffer.PixelCount())
+        {
+            countPixels = leftBuffer.PixelCount();
+        }
+        if (countPixels > rightBuffer.PixelCount())
+        {
+            countPixels = rightBuffer.PixelCount();
+        }
+
+        LinearBlend<T_COLOR_FEATURE>(destBuffer.Pixels, 
+            leftBuffer.Pixels, 
+            rightBuffer.Pixels, 
+            countPixels, 
+            progress);
+    }
+
+    // ------------------------------------------------------------------------
+    // LinearBlend between count pixels of two native pixel spans
+    // pDest, pLeft, pRight - the first pixel of each span
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_FEATURE> static void LinearBlend(uint8_t* pDest,
+        const uint8_t* pLeft,
+        const uint8_t* pRight,
+        uint16_t countPixels,
+        uint8_t progress)
+    {
+        size_t sizeBytes = static_cast<size_t>(countPixels) * T_COLOR_FEATURE::PixelSize;
+
+        if (T_COLOR_FEATURE::ColorObject::Max > 255)
+        {
+            LinearBlendWords(pDest, pLeft, pRight, sizeBytes / 2, progress);
+        }
+        else
+        {
+            LinearBlendBytes(pDest, pLeft, pRight, sizeBytes, progress);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // LinearBlendBytes blends 8 bit elements, packing two elements in each
+    // half of a 32 bit word so four are blended with two multiplies each
+    // ------------------------------------------------------------------------
+    static void LinearBlendBytes(uint8_t* pDest,
+        const uint8_t* pLeft,
+        const uint8_t* pRight,
+        size_t count,
+        uint8_t progress)
+    {
+        const uint32_t weightRight = weight(progress);
+        const uint32_t weightLeft = 256 - weightRight;
+
+        // bytes until the destination is word aligned
+        while (count && (reinterpret_cast<uintptr_t>(pDest) & 0x03))
+        {
+            *pDest++ = blendElement(*pLeft++, *pRight++, weightLeft, weightRight);
+            count--;
+        }
+
+        if (((reinterpret_cast<uintptr_t>(pLeft) | reinterpret_cast<uintptr_t>(pRight)) & 0x03) == 0)
+        {
+            uint32_t* pDestWord = reinterpret_cast<uint32_t*>(pDest);
+            const uint32_t* pLeftWord = reinterpret_cast<const uint32_t*>(pLeft);
+            const uint32_t* pRightWord = reinterpret_cast<const uint32_t*>(pRight);
+            const uint32_t* pLeftEnd = pLeftWord + count / 4;
+
+            while (pLeftWord < pLeftEnd)
+            {
+                uint32_t left = *pLeftWord++;
+                uint32_t right = *pRightWord++;
+
+                // each 16 bit lane holds one element, the sum of the weighted
+                // elements never exceeds 0xff80 so lanes do not carry
+                uint32_t low = (left & 0x00ff00ff) * weightLeft +
+                    (right & 0x00ff00ff) * weightRight + 0x00800080;
+                uint32_t high = ((left >> 8) & 0x00ff00ff) * weightLeft +
+                    ((right >> 8) & 0x00ff00ff) * weightRight + 0x00800080;
+
+                *pDestWord++ = ((low >> 8) & 0x00ff00ff) | (high & 0xff00ff00);
+            }
+
+            pDest = reinterpret_cast<uint8_t*>(pDestWord);
+            pLeft = reinterpret_cast<const uint8_t*>(pLeftWord);
+            pRight = reinterpret_cast<const uint8_t*>(pRightWord);
+            count &= 0x03;
+        }
+
+        while (count--)
+        {
+            *pDest++ = blendElement(*pLeft++, *pRight++, weightLeft, weightRight);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // LinearBlendWords blends 16 bit elements stored most significant byte 
+    // first as the word features store them
+    // ------------------------------------------------------------------------
+    static void LinearBlendWords(uint8_t* pDest,
+        const uint8_t* pLeft,
+        const uint8_t* pRight,
+        size_t count,
+        uint8_t progress)
+    {
+        const uint32_t weightRight = weight(progress);
+        const uint32_t weightLeft = 256 - weightRight;
+
+        while (count--)
+        {
+            uint32_t left = (static_cast<uint32_t>(pLeft[0]) << 8) | pLeft[1];
+            uint32_t right = (static_cast<uint32_t>(pRight[0]) << 8) | pRight[1];
+            uint32_t result = blendElement(left, right, weightLeft, weightRight);
+
+            pDest[0] = result >> 8;
+            pDest[1] = result & 0xff;
+
+            pDest += 2;
+            pLeft += 2;
+            pRight += 2;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // OklabBlend between all pixels of two buffers, blending perceptually
+    // using NeoOklabBlend; only features with RgbColor or RgbwColor color 
+    // objects are supported
+    // destBuffer - the buffer that receives the blend
+    // leftBuffer - the pixels to start the blend at
+    // rightBuffer - the pixels to end the blend at
+    // progress - (0 - 255) value where 0 will return left and 255 will return right
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_FEATURE> static void OklabBlend(NeoBufferContext<T_COLOR_FEATURE> destBuffer,
+        NeoBufferContext<T_COLOR_FEATURE> leftBuffer,
+        NeoBufferContext<T_COLOR_FEATURE> rightBuffer,
+        uint8_t progress)
+    {
+        uint16_t countPixels = destBuffer.PixelCount();
+
+        if (countPixels > leftBuffer.PixelCount())
+        {
+            countPixels = leftBuffer.PixelCount();
+        }
+        if (countPixels > rightBuffer.PixelCount())
+        {
+            countPixels = rightBuffer.PixelCount();
+        }
+
+        OklabBlend<T_COLOR_FEATURE>(destBuffer.Pixels,
+            leftBuffer.Pixels,
+            rightBuffer.Pixels,
+            countPixels,
+            progress);
+    }
+
+    // ------------------------------------------------------------------------
+    // OklabBlend between count pixels of two native pixel spans
+    // pDest, pLeft, pRight - the first pixel of each span
+    // Runs of repeated pixel pairs, common in fills and fades, reuse the 
+    // previous blend rather than converting again
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_FEATURE> static void OklabBlend(uint8_t* pDest,
+        const uint8_t* pLeft,
+        const uint8_t* pRight,
+        uint16_t countPixels,
+        uint8_t progress)
+    {
+        typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+
+        if (countPixels == 0)
+        {
+            return;
+        }
+
+        ColorObject lastLeft = T_COLOR_FEATURE::retrievePixelColor(pLeft, 0);
+        ColorObject lastRight = T_COLOR_FEATURE::retrievePixelColor(pRight, 0);
+        ColorObject lastResult = NeoOklabBlend::LinearBlend(lastLeft, lastRight, progress);
+
+        T_COLOR_FEATURE::applyPixelColor(pDest, 0, lastResult);
+
+        for (uint16_t index = 1; index < countPixels; index++)
+        {
+            ColorObject left = T_COLOR_FEATURE::retrievePixelColor(pLeft, index);
+            ColorObject right = T_COLOR_FEATURE::retrievePixelColor(pRight, index);
+
+            if (left != lastLeft || right != lastRight)
+            {
+                lastLeft = left;
+                lastRight = right;
+                lastResult = NeoOklabBlend::LinearBlend(left, right, progress);
+            }
+            T_COLOR_FEATURE::applyPixelColor(pDest, index, lastResult);
+        }
+    }
+
+private:
+    // maps progress (0 - 255) to a weight (0 - 256) so 255 is fully right
+    static uint32_t weight(uint8_t progress)
+    {
+        return static_cast<uint32_t>(progress) + (progress >> 7);
+    }
+
+    static uint32_t blendElement(uint32_t left, 
+        uint32_t right, 
+        uint32_t weightLeft, 
+        uint32_t weightRight)
+    {
+        return (left * weightLeft + right * weightRight + 0x80) >> 8;
+    }
+};
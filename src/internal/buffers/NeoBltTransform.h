@@ -0,0 +1,235 @@
+/*-------------------------------------------------------------------------
+NeoBltTransform - the orientation and sampling filters used by the
+scaled and transformed Blt methods (StretchBlt)
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// the rotations are clockwise and are applied before the flips,
+// a rotation can be combined with one or both flips
+enum NeoBltTransform
+{
+    NeoBltTransform_None = 0x00,
+    NeoBltTransform_Rotate90 = 0x01,
+    NeoBltTransform_Rotate180 = 0x02,
+    NeoBltTransform_Rotate270 = 0x03,
+    NeoBltTransform_FlipX = 0x04,
+    NeoBltTransform_FlipY = 0x08,
+
+    NeoBltTransform_RotateMask = 0x03
+};
+
+// NeoBltStepper maps destination pixels to source coordinates using 
+// 16.16 fixed point values so that no floats are needed per pixel.
+// The source coordinate of any destination pixel is an affine function 
+// of the destination x,y, so walking a row is just an add per pixel
+// 
+class NeoBltStepper
+{
+public:
+    static const int32_t One = 0x00010000;
+    static const int32_t Half = 0x00008000;
+
+    NeoBltStepper(int16_t wDest,
+        int16_t hDest,
+        int16_t xSrc,
+        int16_t ySrc,
+        int16_t wSrc,
+        int16_t hSrc,
+        uint8_t transform)
+    {
+        uint8_t rotate = transform & NeoBltTransform_RotateMask;
+        bool swapAxis = (rotate & 0x01);
+
+        // size of the source after being rotated
+        int32_t wRotated = swapAxis ? hSrc : wSrc;
+        int32_t hRotated = swapAxis ? wSrc : hSrc;
+
+        // step and first sample in rotated space, pixel n covers 
+        // the span n to n+1 and each destination pixel samples its center
+        int32_t stepX = (wRotated * One) / wDest;
+        int32_t stepY = (hRotated * One) / hDest;
+        int32_t originX = stepX / 2;
+        int32_t originY = stepY / 2;
+
+        if (transform & NeoBltTransform_FlipX)
+        {
+            originX = (wRotated * One) - originX;
+            stepX = -stepX;
+        }
+        if (transform & NeoBltTransform_FlipY)
+        {
+            originY = (hRotated * One) - originY;
+            stepY = -stepY;
+        }
+
+        // map the rotated space back into the source space
+        switch (rotate)
+        {
+        case NeoBltTransform_Rotate90:
+            // src x = rotated y, src y = hSrc - rotated x
+            _originX = originY;
+            _originY = (hSrc * One) - originX;
+            _stepXByX = 0;
+            _stepYByX = -stepX;
+            _stepXByY = stepY;
+            _stepYByY = 0;
+            break;
+
+        case NeoBltTransform_Rotate180:
+            _originX = (wSrc * One) - originX;
+            _originY = (hSrc * One) - originY;
+            _stepXByX = -stepX;
+            _stepYByX = 0;
+            _stepXByY = 0;
+            _stepYByY = -stepY;
+            break;
+
+        case NeoBltTransform_Rotate270:
+            // src x = wSrc - rotated y, src y = rotated x
+            _originX = (wSrc * One) - originY;
+            _originY = originX;
+            _stepXByX = 0;
+            _stepYByX = stepX;
+            _stepXByY = -stepY;
+            _stepYByY = 0;
+            break;
+
+        default:
+            _originX = originX;
+            _originY = originY;
+            _stepXByX = stepX;
+            _stepYByX = 0;
+            _stepXByY = 0;
+            _stepYByY = stepY;
+            break;
+        }
+
+        _originX += xSrc * One;
+        _originY += ySrc * One;
+    }
+
+    // source coordinate of the first pixel of the given destination row
+    int32_t RowX(int16_t yDest) const
+    {
+        return _originX + _stepXByY * yDest;
+    }
+
+    int32_t RowY(int16_t yDest) const
+    {
+        return _originY + _stepYByY * yDest;
+    }
+
+    // source coordinate delta for each destination pixel across a row
+    int32_t StepX() const
+    {
+        return _stepXByX;
+    }
+
+    int32_t StepY() const
+    {
+        return _stepYByX;
+    }
+
+private:
+    int32_t _originX;
+    int32_t _originY;
+    int32_t _stepXByX;
+    int32_t _stepYByX;
+    int32_t _stepXByY;
+    int32_t _stepYByY;
+};
+
+// NeoBltNearestFilter picks the single source pixel under the sample point
+// 
+class NeoBltNearestFilter
+{
+public:
+    template <typename T_SOURCE> static typename T_SOURCE::ColorObject Sample(T_SOURCE& src,
+        int32_t x,
+        int32_t y,
+        int16_t xMin,
+        int16_t yMin,
+        int16_t xMax,
+        int16_t yMax)
+    {
+        return src.GetPixelColor(clamp(x >> 16, xMin, xMax), 
+            clamp(y >> 16, yMin, yMax));
+    }
+
+protected:
+    static int16_t clamp(int32_t value, int16_t min, int16_t max)
+    {
+        if (value < min)
+        {
+            return min;
+        }
+        else if (value > max)
+        {
+            return max;
+        }
+        return value;
+    }
+};
+
+// NeoBltBilinearFilter blends the four source pixels around the sample point
+// using the fixed point NeoProgress16 BilinearBlend of the color object
+// 
+class NeoBltBilinearFilter : public NeoBltNearestFilter
+{
+public:
+    template <typename T_SOURCE> static typename T_SOURCE::ColorObject Sample(T_SOURCE& src,
+        int32_t x,
+        int32_t y,
+        int16_t xMin,
+        int16_t yMin,
+        int16_t xMax,
+        int16_t yMax)
+    {
+        // move pixel centers onto integer coordinates, 
+        // arithmetic shift floors the negative values of the first half pixel
+        x -= NeoBltStepper::Half;
+        y -= NeoBltStepper::Half;
+
+        int16_t x0 = clamp(x >> 16, xMin, xMax);
+        int16_t y0 = clamp(y >> 16, yMin, yMax);
+        int16_t x1 = clamp((x >> 16) + 1, xMin, xMax);
+        int16_t y1 = clamp((y >> 16) + 1, yMin, yMax);
+        uint16_t fractionX = x & 0xffff;
+        uint16_t fractionY = y & 0xffff;
+
+        if (fractionX == 0 && fractionY == 0)
+        {
+            return src.GetPixelColor(x0, y0);
+        }
+
+        // BilinearBlend x weight applies to c10 and y weight to c01 
+        return T_SOURCE::ColorObject::BilinearBlend(src.GetPixelColor(x0, y0),
+            src.GetPixelColor(x0, y1),
+            src.GetPixelColor(x1, y0),
+            src.GetPixelColor(x1, y1),
+            NeoProgress16(fractionX),
+            NeoProgress16(fractionY));
+    }
+};
@@ -28,6 +28,8 @@ License along with NeoPixel.  If not, see
 // T_BUFFER_METHOD - one of
 //      NeoBufferMethod
 //      NeoBufferProgmemMethod
+//      NeoBufferRleProgmemMethod
+//      NeoBufferPaletteMethod
 //
 template<typename T_BUFFER_METHOD> class NeoBuffer
 {
@@ -37,6 +39,7 @@ public:
         PGM_VOID_P pixels = nullptr) :
         _method(width, height, pixels)
     {
+        Dirty();
     }
 
     ~NeoBuffer()
@@ -45,6 +48,7 @@ public:
 
     operator NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature>()
     {
+        Dirty(); // we assume you are playing with bits
         return _method;
     }
 
@@ -68,7 +72,13 @@ public:
         int16_t y,
         typename T_BUFFER_METHOD::ColorObject color)
     {
-        _method.SetPixelColor(PixelIndex(x, y), color);
+        uint16_t indexPixel = PixelIndex(x, y);
+
+        if (indexPixel != PixelIndex_OutOfBounds)
+        {
+            _method.SetPixelColor(indexPixel, color);
+            DirtyPixel(x, y);
+        }
     };
 
     typename T_BUFFER_METHOD::ColorObject GetPixelColor(
@@ -81,6 +91,63 @@ public:
     void ClearTo(typename T_BUFFER_METHOD::ColorObject color)
     {
         _method.ClearTo(color);
+        Dirty();
+    };
+
+    // the following palette methods are only available when T_BUFFER_METHOD
+    // is a NeoBufferPaletteMethod
+    void SetPixelIndex(
+        int16_t x,
+        int16_t y,
+        uint8_t indexPalette)
+    {
+        uint16_t indexPixel = PixelIndex(x, y);
+
+        if (indexPixel != PixelIndex_OutOfBounds)
+        {
+            _method.SetPixelIndex(indexPixel, indexPalette);
+            DirtyPixel(x, y);
+        }
+    };
+
+    uint8_t GetPixelIndex(
+        int16_t x,
+        int16_t y) const
+    {
+        return _method.GetPixelIndex(PixelIndex(x, y));
+    };
+
+    void ClearToIndex(uint8_t indexPalette)
+    {
+        _method.ClearToIndex(indexPalette);
+        Dirty();
+    };
+
+    void SetPaletteColor(uint8_t indexPalette, typename T_BUFFER_METHOD::ColorObject color)
+    {
+        _method.SetPaletteColor(indexPalette, color);
+        Dirty();
+    };
+
+    typename T_BUFFER_METHOD::ColorObject GetPaletteColor(uint8_t indexPalette) const
+    {
+        return _method.GetPaletteColor(indexPalette);
+    };
+
+    void RotatePaletteLeft(uint16_t rotationCount, 
+        uint8_t first = 0, 
+        uint8_t last = T_BUFFER_METHOD::PaletteCount - 1)
+    {
+        _method.RotatePaletteLeft(rotationCount, first, last);
+        Dirty();
+    };
+
+    void RotatePaletteRight(uint16_t rotationCount, 
+        uint8_t first = 0, 
+        uint8_t last = T_BUFFER_METHOD::PaletteCount - 1)
+    {
+        _method.RotatePaletteRight(rotationCount, first, last);
+        Dirty();
     };
 
     void Blt(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
@@ -102,7 +169,7 @@ public:
         }
 
         uint8_t* pDest = T_BUFFER_METHOD::ColorFeature::getPixelAddress(destBuffer.Pixels, indexPixel);
-        _method.CopyPixels(pDest, _method.Pixels(), copyCount);
+        copyPixels(pDest, 0, copyCount);
     }
 
     void Blt(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
@@ -115,19 +182,57 @@ public:
         LayoutMapCallback layoutMap)
     {
         uint16_t destPixelCount = destBuffer.PixelCount();
+        uint32_t window[WindowSize];
+
+        // clip the source to the buffer
+        if (xSrc < 0)
+        {
+            xDest -= xSrc;
+            wSrc += xSrc;
+            xSrc = 0;
+        }
+        if (ySrc < 0)
+        {
+            yDest -= ySrc;
+            hSrc += ySrc;
+            ySrc = 0;
+        }
+        if (xSrc + wSrc > static_cast<int16_t>(Width()))
+        {
+            wSrc = Width() - xSrc;
+        }
+        if (ySrc + hSrc > static_cast<int16_t>(Height()))
+        {
+            hSrc = Height() - ySrc;
+        }
 
         for (int16_t y = 0; y < hSrc; y++)
         {
-            for (int16_t x = 0; x < wSrc; x++)
+            for (int16_t x = 0; x < wSrc; x += WindowPixelCount)
             {
-                uint16_t indexDest = layoutMap(xDest + x, yDest + y);
- 
-                if (indexDest < destPixelCount)
+                uint16_t count = wSrc - x;
+
+                if (count > WindowPixelCount)
                 {
-                    const uint8_t* pSrc = T_BUFFER_METHOD::ColorFeature::getPixelAddress(_method.Pixels(), PixelIndex(xSrc + x, ySrc + y));
-                    uint8_t* pDest = T_BUFFER_METHOD::ColorFeature::getPixelAddress(destBuffer.Pixels, indexDest);
+                    count = WindowPixelCount;
+                }
 
-                    _method.CopyPixels(pDest, pSrc, 1);
+                const uint8_t* pSrc = _method.DecodePixels(reinterpret_cast<uint8_t*>(window), 
+                    PixelIndex(xSrc + x, ySrc + y), 
+                    count);
+
+                for (uint16_t pixel = 0; pixel < count; pixel++)
+                {
+                    uint16_t indexDest = layoutMap(xDest + x + pixel, yDest + y);
+
+                    if (indexDest < destPixelCount)
+                    {
+                        uint8_t* pDest = T_BUFFER_METHOD::ColorFeature::getPixelAddress(destBuffer.Pixels, indexDest);
+
+                        _method.CopyPixels(pDest, 
+                            T_BUFFER_METHOD::ColorFeature::getPixelAddress(pSrc, pixel),
+                            1);
+                    }
                 }
             }
         }
@@ -141,6 +246,73 @@ public:
         Blt(destBuffer, xDest, yDest, 0, 0, Width(), Height(), layoutMap);
     }
 
+    // Blt the source rectangle scaled to fill the destination rectangle
+    // and optionally rotated and/or flipped, see NeoBltTransform
+    // T_BLT_FILTER - one of
+    //      NeoBltNearestFilter
+    //      NeoBltBilinearFilter
+    //
+    template <typename T_BLT_FILTER = NeoBltNearestFilter> void StretchBlt(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        int16_t xDest,
+        int16_t yDest,
+        int16_t wDest,
+        int16_t hDest,
+        int16_t xSrc,
+        int16_t ySrc,
+        int16_t wSrc,
+        int16_t hSrc,
+        LayoutMapCallback layoutMap,
+        uint8_t transform = NeoBltTransform_None)
+    {
+        if (wDest <= 0 || hDest <= 0 || wSrc <= 0 || hSrc <= 0)
+        {
+            return;
+        }
+
+        uint16_t destPixelCount = destBuffer.PixelCount();
+        NeoBltStepper stepper(wDest, hDest, xSrc, ySrc, wSrc, hSrc, transform);
+        int16_t xMax = xSrc + wSrc - 1;
+        int16_t yMax = ySrc + hSrc - 1;
+
+        for (int16_t y = 0; y < hDest; y++)
+        {
+            int32_t sx = stepper.RowX(y);
+            int32_t sy = stepper.RowY(y);
+
+            for (int16_t x = 0; x < wDest; x++)
+            {
+                uint16_t indexDest = layoutMap(xDest + x, yDest + y);
+
+                if (indexDest < destPixelCount)
+                {
+                    typename T_BUFFER_METHOD::ColorObject color = T_BLT_FILTER::Sample(_method, 
+                        sx, 
+                        sy, 
+                        xSrc, 
+                        ySrc, 
+                        xMax, 
+                        yMax);
+
+                    T_BUFFER_METHOD::ColorFeature::applyPixelColor(destBuffer.Pixels, indexDest, color);
+                }
+
+                sx += stepper.StepX();
+                sy += stepper.StepY();
+            }
+        }
+    }
+
+    template <typename T_BLT_FILTER = NeoBltNearestFilter> void StretchBlt(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        int16_t xDest,
+        int16_t yDest,
+        int16_t wDest,
+        int16_t hDest,
+        LayoutMapCallback layoutMap,
+        uint8_t transform = NeoBltTransform_None)
+    {
+        StretchBlt<T_BLT_FILTER>(destBuffer, xDest, yDest, wDest, hDest, 0, 0, Width(), Height(), layoutMap, transform);
+    }
+
     template <typename T_SHADER> void Render(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer, T_SHADER& shader)
     {
         uint16_t countPixels = destBuffer.PixelCount();
@@ -150,15 +322,222 @@ public:
             countPixels = _method.PixelCount();
         }
 
-        for (uint16_t indexPixel = 0; indexPixel < countPixels; indexPixel++)
+        renderPixels<T_SHADER>(destBuffer, shader, 0, countPixels);
+    }
+
+    // Render into a destination of another feature, the shader converts each
+    // pixel and defines the feature it writes as T_SHADER::DestFeature,
+    // like NeoWhiteExtractor
+    template <typename T_SHADER> void Render(NeoBufferContext<typename T_SHADER::DestFeature> destBuffer, T_SHADER& shader)
+    {
+        uint16_t countPixels = destBuffer.PixelCount();
+
+        if (countPixels > _method.PixelCount())
+        {
+            countPixels = _method.PixelCount();
+        }
+
+        renderPixels<T_SHADER, typename T_SHADER::DestFeature>(destBuffer, shader, 0, countPixels);
+    }
+
+    // Blt only the region changed since the last ResetDirty() and then
+    // reset the dirty state; the destination is expected to still hold 
+    // the remaining pixels from a previous Blt
+    void BltDirty(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        uint16_t indexPixel)
+    {
+        if (IsDirty())
+        {
+            uint16_t destPixelCount = destBuffer.PixelCount();
+            uint16_t countRow = _dirtyRight - _dirtyLeft;
+            int16_t bottom = _dirtyBottom;
+
+            // a full width dirty region is contiguous, copy it as one row
+            if (countRow == Width())
+            {
+                countRow *= (_dirtyBottom - _dirtyTop);
+                bottom = _dirtyTop + 1;
+            }
+
+            for (int16_t y = _dirtyTop; y < bottom; y++)
+            {
+                uint16_t indexSrc = PixelIndex(_dirtyLeft, y);
+                uint16_t indexDest = indexPixel + indexSrc;
+
+                if (indexDest >= destPixelCount)
+                {
+                    break;
+                }
+
+                uint16_t copyCount = destPixelCount - indexDest;
+
+                if (copyCount > countRow)
+                {
+                    copyCount = countRow;
+                }
+
+                uint8_t* pDest = T_BUFFER_METHOD::ColorFeature::getPixelAddress(destBuffer.Pixels, indexDest);
+                copyPixels(pDest, indexSrc, copyCount);
+            }
+
+            ResetDirty();
+        }
+    }
+
+    void BltDirty(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        int16_t xDest,
+        int16_t yDest,
+        LayoutMapCallback layoutMap)
+    {
+        if (IsDirty())
+        {
+            Blt(destBuffer,
+                xDest + _dirtyLeft,
+                yDest + _dirtyTop,
+                _dirtyLeft,
+                _dirtyTop,
+                _dirtyRight - _dirtyLeft,
+                _dirtyBottom - _dirtyTop,
+                layoutMap);
+            ResetDirty();
+        }
+    }
+
+    // Render only when either the buffer or the shader changed, when only the
+    // buffer changed just the dirty region is processed by the shader
+    template <typename T_SHADER> void RenderDirty(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer, T_SHADER& shader)
+    {
+        if (shader.IsDirty())
+        {
+            Render<T_SHADER>(destBuffer, shader);
+        }
+        else if (IsDirty())
         {
-            const uint8_t* pSrc = T_BUFFER_METHOD::ColorFeature::getPixelAddress(_method.Pixels(), indexPixel);
-            uint8_t* pDest = T_BUFFER_METHOD::ColorFeature::getPixelAddress(destBuffer.Pixels, indexPixel);
+            uint16_t countPixels = destBuffer.PixelCount();
+
+            for (int16_t y = _dirtyTop; y < _dirtyBottom; y++)
+            {
+                uint16_t indexPixel = PixelIndex(_dirtyLeft, y);
+                uint16_t indexEnd = indexPixel + (_dirtyRight - _dirtyLeft);
 
-            shader.Apply(indexPixel, pDest, pSrc);
+                if (indexEnd > countPixels)
+                {
+                    indexEnd = countPixels;
+                }
+                if (indexPixel < indexEnd)
+                {
+                    renderPixels<T_SHADER>(destBuffer, shader, indexPixel, indexEnd - indexPixel);
+                }
+            }
         }
+
+        shader.ResetDirty();
+        ResetDirty();
     }
 
+    bool IsDirty() const
+    {
+        return (_dirtyLeft < _dirtyRight);
+    };
+
+    // marks the whole buffer as changed
+    void Dirty()
+    {
+        _dirtyLeft = 0;
+        _dirtyTop = 0;
+        _dirtyRight = Width();
+        _dirtyBottom = Height();
+    };
+
+    // marks the given rectangle as changed, growing the dirty region to include it
+    void Dirty(int16_t x,
+        int16_t y,
+        int16_t w,
+        int16_t h)
+    {
+        int16_t right = x + w;
+        int16_t bottom = y + h;
+
+        // clip to the buffer
+        if (x < 0)
+        {
+            x = 0;
+        }
+        if (y < 0)
+        {
+            y = 0;
+        }
+        if (right > static_cast<int16_t>(Width()))
+        {
+            right = Width();
+        }
+        if (bottom > static_cast<int16_t>(Height()))
+        {
+            bottom = Height();
+        }
+
+        if (x >= right || y >= bottom)
+        {
+            return;
+        }
+
+        if (!IsDirty())
+        {
+            _dirtyLeft = x;
+            _dirtyTop = y;
+            _dirtyRight = right;
+            _dirtyBottom = bottom;
+        }
+        else
+        {
+            if (x < _dirtyLeft)
+            {
+                _dirtyLeft = x;
+            }
+            if (y < _dirtyTop)
+            {
+                _dirtyTop = y;
+            }
+            if (right > _dirtyRight)
+            {
+                _dirtyRight = right;
+            }
+            if (bottom > _dirtyBottom)
+            {
+                _dirtyBottom = bottom;
+            }
+        }
+    };
+
+    void ResetDirty()
+    {
+        _dirtyLeft = 0;
+        _dirtyTop = 0;
+        _dirtyRight = 0;
+        _dirtyBottom = 0;
+    };
+
+    // the bounding rectangle of the changes since the last ResetDirty()
+    int16_t DirtyX() const
+    {
+        return _dirtyLeft;
+    };
+
+    int16_t DirtyY() const
+    {
+        return _dirtyTop;
+    };
+
+    int16_t DirtyWidth() const
+    {
+        return _dirtyRight - _dirtyLeft;
+    };
+
+    int16_t DirtyHeight() const
+    {
+        return _dirtyBottom - _dirtyTop;
+    };
+
     uint16_t PixelIndex(
         int16_t x,
         int16_t y) const
@@ -176,5 +555,88 @@ public:
     }
 
 private:
+    // pixels decoded at once for methods that store them compressed
+    static const uint16_t WindowPixelCount = 8;
+    static const size_t WindowSize = (T_BUFFER_METHOD::ColorFeature::PixelSize * WindowPixelCount + 3) / 4;
+
     T_BUFFER_METHOD _method;
+
+    // dirty bounding rectangle, right and bottom are exclusive
+    int16_t _dirtyLeft;
+    int16_t _dirtyTop;
+    int16_t _dirtyRight;
+    int16_t _dirtyBottom;
+
+    void DirtyPixel(int16_t x, int16_t y)
+    {
+        if (!IsDirty())
+        {
+            _dirtyLeft = x;
+            _dirtyTop = y;
+            _dirtyRight = x + 1;
+            _dirtyBottom = y + 1;
+        }
+        else
+        {
+            if (x < _dirtyLeft)
+            {
+                _dirtyLeft = x;
+            }
+            else if (x >= _dirtyRight)
+            {
+                _dirtyRight = x + 1;
+            }
+            if (y < _dirtyTop)
+            {
+                _dirtyTop = y;
+            }
+            else if (y >= _dirtyBottom)
+            {
+                _dirtyBottom = y + 1;
+            }
+        }
+    }
+
+    void copyPixels(uint8_t* pDest, uint16_t indexSrc, uint16_t count)
+    {
+        // methods that store compressed pixels decode straight into the destination
+        const uint8_t* pSrc = _method.DecodePixels(pDest, indexSrc, count);
+
+        if (pSrc != pDest)
+        {
+            _method.CopyPixels(pDest, pSrc, count);
+        }
+    }
+
+    template <typename T_SHADER, 
+        typename T_DEST_FEATURE = typename T_BUFFER_METHOD::ColorFeature> void renderPixels(NeoBufferContext<T_DEST_FEATURE> destBuffer,
+        T_SHADER& shader,
+        uint16_t indexPixel,
+        uint16_t count)
+    {
+        uint32_t window[WindowSize];
+
+        while (count)
+        {
+            uint16_t countWindow = (count > WindowPixelCount) ? WindowPixelCount : count;
+            const uint8_t* pSrc = _method.DecodePixels(reinterpret_cast<uint8_t*>(window), indexPixel, countWindow);
+            uint8_t* pDest = T_DEST_FEATURE::getPixelAddress(destBuffer.Pixels, indexPixel);
+
+            if (!T_BUFFER_METHOD::IsRamPixels && pSrc != reinterpret_cast<uint8_t*>(window))
+            {
+                // shaders read the source as RAM, so pixels the method keeps
+                // in PROGMEM and doesn't decode are copied into the window
+                _method.CopyPixels(reinterpret_cast<uint8_t*>(window), pSrc, countWindow);
+                pSrc = reinterpret_cast<uint8_t*>(window);
+            }
+
+            count -= countWindow;
+            while (countWindow--)
+            {
+                shader.Apply(indexPixel++, pDest, pSrc);
+                pDest += T_DEST_FEATURE::PixelSize;
+                pSrc += T_BUFFER_METHOD::ColorFeature::PixelSize;
+            }
+        }
+    }
 };
\ No newline at end of file
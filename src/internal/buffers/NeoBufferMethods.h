@@ -135,6 +135,13 @@ public:
         T_COLOR_FEATURE::replicatePixel(_pixels, temp, PixelCount());
     };
 
+    // returns the address of count pixels starting at indexPixel that can be
+    // used with CopyPixels, pixels are stored uncompressed so pWindow is not used
+    const uint8_t* DecodePixels(uint8_t*, uint16_t indexPixel, uint16_t) const
+    {
+        return T_COLOR_FEATURE::getPixelAddress(_pixels, indexPixel);
+    }
+
     void CopyPixels(uint8_t* pPixelDest, const uint8_t* pPixelSrc, uint16_t count)
     {
         T_COLOR_FEATURE::movePixelsInc(pPixelDest, pPixelSrc, count);
@@ -143,6 +150,9 @@ public:
     typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
     typedef T_COLOR_FEATURE ColorFeature;
 
+    // pixels are in RAM and used in place by NeoBuffer::Render
+    static const bool IsRamPixels = true;
+
 private:
     const uint16_t _width; 
     const uint16_t _height;
@@ -0,0 +1,346 @@
+/*-------------------------------------------------------------------------
+NeoBufferPaletteMethod - a buffer method that stores a palette index for each
+pixel and expands the palette into the feature format as it is used
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// Each pixel is stored as an index into a palette of colors, using 4 bits
+// when V_PALETTE_COUNT is 16 or less and 8 bits otherwise (up to 256).
+// The palette is kept in the native format of the feature, so decoding a
+// pixel is a copy of its palette entry; changing a palette entry changes
+// every pixel using it without touching the pixels.
+// With 4 bit indexes, the first pixel is stored in the high nibble of a byte.
+// The optional PROGMEM pixels used to initialize are packed indexes in the
+// same layout.
+//
+template<typename T_COLOR_FEATURE, uint16_t V_PALETTE_COUNT = 16> class NeoBufferPaletteMethod
+{
+public:
+    static_assert(V_PALETTE_COUNT > 0 && V_PALETTE_COUNT <= 256, "V_PALETTE_COUNT must be 1 to 256");
+
+    static const uint16_t PaletteCount = V_PALETTE_COUNT;
+    static const uint8_t IndexBits = (V_PALETTE_COUNT <= 16) ? 4 : 8;
+
+    NeoBufferPaletteMethod(uint16_t width, uint16_t height, PGM_VOID_P pixels = nullptr) :
+        _width(width),
+        _height(height)
+    {
+        _indexes = static_cast<uint8_t*>(malloc(IndexesSize()));
+        if (pixels)
+        {
+            // copy from progmem to initialize
+            const uint8_t* pSrc = static_cast<const uint8_t*>(pixels);
+
+            for (size_t index = 0; index < IndexesSize(); index++)
+            {
+                _indexes[index] = pgm_read_byte(pSrc + index);
+            }
+        }
+        else
+        {
+            memset(_indexes, 0, IndexesSize());
+        }
+        memset(_palette, 0, sizeof(_palette));
+    }
+
+    ~NeoBufferPaletteMethod()
+    {
+        free(_indexes);
+        _indexes = nullptr;
+    }
+
+    operator NeoBufferContext<T_COLOR_FEATURE>()
+    {
+        // there are no pixels in the feature format that can be directly accessed
+        return NeoBufferContext<T_COLOR_FEATURE>(nullptr, 0);
+    }
+
+    uint8_t* Indexes() const
+    {
+        return _indexes;
+    };
+
+    size_t IndexesSize() const
+    {
+        return (static_cast<size_t>(PixelCount()) * IndexBits + 7) / 8;
+    };
+
+    size_t PixelSize() const
+    {
+        return T_COLOR_FEATURE::PixelSize;
+    };
+
+    uint16_t PixelCount() const
+    {
+        return _width * _height;
+    };
+
+    uint16_t Width() const
+    {
+        return _width;
+    };
+
+    uint16_t Height() const
+    {
+        return _height;
+    };
+
+    // sets the pixel to the palette entry closest to color, this searches
+    // the whole palette so use SetPixelIndex when the index is known
+    void SetPixelColor(uint16_t indexPixel, typename T_COLOR_FEATURE::ColorObject color)
+    {
+        SetPixelIndex(indexPixel, NearestPaletteIndex(color));
+    };
+
+    void SetPixelColor(int16_t x, int16_t y, typename T_COLOR_FEATURE::ColorObject color)
+    {
+        if (x < 0 || x >= _width || y < 0 || y >= _height)
+        {
+            return;
+        }
+
+        SetPixelColor(static_cast<uint16_t>(x + y * _width), color);
+    };
+
+    typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t indexPixel) const
+    {
+        if (indexPixel >= PixelCount())
+        {
+            // Pixel # is out of bounds, this will get converted to a 
+            // color object type initialized to 0 (black)
+            return 0;
+        }
+
+        return GetPaletteColor(getIndex(indexPixel));
+    };
+
+    typename T_COLOR_FEATURE::ColorObject GetPixelColor(int16_t x, int16_t y) const
+    {
+        if (x < 0 || x >= _width || y < 0 || y >= _height)
+        {
+            // Pixel # is out of bounds, this will get converted to a 
+            // color object type initialized to 0 (black)
+            return 0;
+        }
+
+        return GetPixelColor(static_cast<uint16_t>(x + y * _width));
+    };
+
+    void SetPixelIndex(uint16_t indexPixel, uint8_t indexPalette)
+    {
+        if (indexPixel < PixelCount() && indexPalette < PaletteCount)
+        {
+            setIndex(indexPixel, indexPalette);
+        }
+    };
+
+    uint8_t GetPixelIndex(uint16_t indexPixel) const
+    {
+        if (indexPixel >= PixelCount())
+        {
+            return 0;
+        }
+
+        return getIndex(indexPixel);
+    };
+
+    void ClearTo(typename T_COLOR_FEATURE::ColorObject color)
+    {
+        ClearToIndex(NearestPaletteIndex(color));
+    };
+
+    void ClearToIndex(uint8_t indexPalette)
+    {
+        if (indexPalette < PaletteCount)
+        {
+            uint8_t value = (IndexBits == 4) ? (indexPalette << 4 | indexPalette) : indexPalette;
+
+            memset(_indexes, value, IndexesSize());
+        }
+    };
+
+    void SetPaletteColor(uint8_t indexPalette, typename T_COLOR_FEATURE::ColorObject color)
+    {
+        if (indexPalette < PaletteCount)
+        {
+            T_COLOR_FEATURE::applyPixelColor(_palette, indexPalette, color);
+        }
+    };
+
+    typename T_COLOR_FEATURE::ColorObject GetPaletteColor(uint8_t indexPalette) const
+    {
+        if (indexPalette >= PaletteCount)
+        {
+            return 0;
+        }
+
+        return T_COLOR_FEATURE::retrievePixelColor(_palette, indexPalette);
+    };
+
+    // returns the index of the palette entry with the least difference
+    // summed across the elements of the color
+    uint8_t NearestPaletteIndex(typename T_COLOR_FEATURE::ColorObject color) const
+    {
+        typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+
+        uint8_t nearest = 0;
+        uint32_t nearestDistance = UINT32_MAX;
+
+        for (uint16_t indexPalette = 0; indexPalette < PaletteCount; indexPalette++)
+        {
+            ColorObject entry = GetPaletteColor(indexPalette);
+            uint32_t distance = 0;
+
+            for (size_t element = 0; element < ColorObject::Count; element++)
+            {
+                distance += (entry[element] > color[element]) ?
+                    (entry[element] - color[element]) :
+                    (color[element] - entry[element]);
+            }
+
+            if (distance < nearestDistance)
+            {
+                nearest = indexPalette;
+                nearestDistance = distance;
+                if (distance == 0)
+                {
+                    break;
+                }
+            }
+        }
+        return nearest;
+    };
+
+    // rotates the palette entries first to last, all pixels using them
+    // change without touching the pixels
+    void RotatePaletteLeft(uint16_t rotationCount, uint8_t first = 0, uint8_t last = PaletteCount - 1)
+    {
+        if (last < PaletteCount && first < last)
+        {
+            uint16_t count = last - first + 1;
+
+            rotationCount %= count;
+            if (rotationCount)
+            {
+                reversePalette(first, first + rotationCount - 1);
+                reversePalette(first + rotationCount, last);
+                reversePalette(first, last);
+            }
+        }
+    };
+
+    void RotatePaletteRight(uint16_t rotationCount, uint8_t first = 0, uint8_t last = PaletteCount - 1)
+    {
+        if (last < PaletteCount && first < last)
+        {
+            uint16_t count = last - first + 1;
+
+            RotatePaletteLeft(count - rotationCount % count, first, last);
+        }
+    };
+
+    // expands count pixels starting at indexPixel into pWindow and returns it
+    const uint8_t* DecodePixels(uint8_t* pWindow, uint16_t indexPixel, uint16_t count) const
+    {
+        uint8_t* pDest = pWindow;
+
+        while (count--)
+        {
+            const uint8_t* pEntry = _palette + getIndex(indexPixel++) * T_COLOR_FEATURE::PixelSize;
+
+            for (size_t b = 0; b < T_COLOR_FEATURE::PixelSize; b++)
+            {
+                *pDest++ = pEntry[b];
+            }
+        }
+
+        return pWindow;
+    }
+
+    void CopyPixels(uint8_t* pPixelDest, const uint8_t* pPixelSrc, uint16_t count)
+    {
+        // source is always expanded pixels in RAM
+        T_COLOR_FEATURE::movePixelsInc(pPixelDest, pPixelSrc, count);
+    }
+
+    typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+    typedef T_COLOR_FEATURE ColorFeature;
+
+    // pixels are in RAM, DecodePixels expands them into the window
+    static const bool IsRamPixels = true;
+
+private:
+    const uint16_t _width;
+    const uint16_t _height;
+    uint8_t* _indexes;
+    uint8_t _palette[PaletteCount * T_COLOR_FEATURE::PixelSize];
+
+    uint8_t getIndex(uint16_t indexPixel) const
+    {
+        if (IndexBits == 4)
+        {
+            uint8_t value = _indexes[indexPixel >> 1];
+
+            return (indexPixel & 1) ? (value & 0x0f) : (value >> 4);
+        }
+        return _indexes[indexPixel];
+    }
+
+    void setIndex(uint16_t indexPixel, uint8_t indexPalette)
+    {
+        if (IndexBits == 4)
+        {
+            uint8_t* pValue = &_indexes[indexPixel >> 1];
+
+            *pValue = (indexPixel & 1) ?
+                ((*pValue & 0xf0) | indexPalette) :
+                ((*pValue & 0x0f) | (indexPalette << 4));
+        }
+        else
+        {
+            _indexes[indexPixel] = indexPalette;
+        }
+    }
+
+    void reversePalette(uint16_t first, uint16_t last)
+    {
+        while (first < last)
+        {
+            uint8_t* pFirst = _palette + first * T_COLOR_FEATURE::PixelSize;
+            uint8_t* pLast = _palette + last * T_COLOR_FEATURE::PixelSize;
+
+            for (size_t b = 0; b < T_COLOR_FEATURE::PixelSize; b++)
+            {
+                uint8_t temp = pFirst[b];
+
+                pFirst[b] = pLast[b];
+                pLast[b] = temp;
+            }
+            first++;
+            last--;
+        }
+    }
+};
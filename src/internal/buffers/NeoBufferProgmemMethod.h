@@ -111,6 +111,13 @@ public:
         // PROGMEM is read only, this will do nothing
     };
 
+    // returns the address of count pixels starting at indexPixel that can be
+    // used with CopyPixels, pixels are stored uncompressed so pWindow is not used
+    const uint8_t* DecodePixels(uint8_t*, uint16_t indexPixel, uint16_t) const
+    {
+        return T_COLOR_FEATURE::getPixelAddress(Pixels(), indexPixel);
+    }
+
     void CopyPixels(uint8_t* pPixelDest, const uint8_t* pPixelSrc, uint16_t count)
     {
         T_COLOR_FEATURE::movePixelsInc_P(pPixelDest, pPixelSrc, count);
@@ -119,6 +126,9 @@ public:
     typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
     typedef T_COLOR_FEATURE ColorFeature;
 
+    // pixels are in PROGMEM, NeoBuffer::Render copies them to RAM for shaders
+    static const bool IsRamPixels = false;
+
 private:
     const uint16_t _width;
     const uint16_t _height;
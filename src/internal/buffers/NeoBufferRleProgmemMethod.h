@@ -0,0 +1,251 @@
+/*-------------------------------------------------------------------------
+NeoBufferRleProgmemMethod - a read only buffer method that keeps the pixels
+run length encoded in PROGMEM and decodes them as they are used
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// The encoded data is made of a row table followed by the packets.
+// The row table has a 16 bit little endian offset for each row, counted from
+// the first byte after the table, so any row can be found without decoding
+// the previous rows.
+// Each packet starts with a control byte followed by pixels in the same
+// native format as the feature (as NeoBufferProgmemMethod expects),
+//      0x80 | (count - 1) - a run, one pixel repeated count times
+//      0x00 | (count - 1) - a literal, count pixels follow
+// Packets never span rows and count is limited to 128.
+// See extras/tools/NeoRleEncoder for a host tool that creates the data.
+// 
+template<typename T_COLOR_FEATURE> class NeoBufferRleProgmemMethod
+{
+public:
+    NeoBufferRleProgmemMethod(uint16_t width, uint16_t height, PGM_VOID_P pixels) :
+        _width(width),
+        _height(height),
+        _rows(reinterpret_cast<const uint8_t*>(pixels)),
+        _packets(reinterpret_cast<const uint8_t*>(pixels) + height * sizeof(uint16_t))
+    {
+        seekRow(0);
+    }
+
+    operator NeoBufferContext<T_COLOR_FEATURE>()
+    {
+        // there are no pixels that can be directly accessed
+        return NeoBufferContext<T_COLOR_FEATURE>(nullptr, 0);
+    }
+
+    size_t PixelSize() const
+    {
+        return T_COLOR_FEATURE::PixelSize;
+    };
+
+    uint16_t PixelCount() const
+    {
+        return _width * _height;
+    };
+
+    uint16_t Width() const
+    {
+        return _width;
+    };
+
+    uint16_t Height() const
+    {
+        return _height;
+    };
+
+    void SetPixelColor(uint16_t indexPixel, typename T_COLOR_FEATURE::ColorObject color)
+    {
+        // PROGMEM is read only, this will do nothing
+    };
+
+    void SetPixelColor(uint16_t x, uint16_t y, typename T_COLOR_FEATURE::ColorObject color)
+    {
+        // PROGMEM is read only, this will do nothing
+    };
+
+    typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t indexPixel) const
+    {
+        if (indexPixel >= PixelCount())
+        {
+            // Pixel # is out of bounds, this will get converted to a 
+            // color object type initialized to 0 (black)
+            return 0;
+        }
+
+        uint8_t pixel[T_COLOR_FEATURE::PixelSize];
+
+        DecodePixels(pixel, indexPixel, 1);
+        return T_COLOR_FEATURE::retrievePixelColor(pixel, 0);
+    };
+
+    typename T_COLOR_FEATURE::ColorObject GetPixelColor(int16_t x, int16_t y) const
+    {
+        if (x < 0 || x >= _width || y < 0 || y >= _height)
+        {
+            // Pixel # is out of bounds, this will get converted to a 
+            // color object type initialized to 0 (black)
+            return 0;
+        }
+
+        return GetPixelColor(static_cast<uint16_t>(x + y * _width));
+    };
+
+    void ClearTo(typename T_COLOR_FEATURE::ColorObject color)
+    {
+        // PROGMEM is read only, this will do nothing
+    };
+
+    // decodes count pixels starting at indexPixel into pWindow and returns it,
+    // decoding continues from the last call so sequential calls are cheap
+    const uint8_t* DecodePixels(uint8_t* pWindow, uint16_t indexPixel, uint16_t count) const
+    {
+        uint8_t* pDest = pWindow;
+
+        seek(indexPixel);
+
+        while (count && _packetFirst < PixelCount())
+        {
+            uint8_t control = pgm_read_byte(_packet);
+            uint16_t countPacket = (control & 0x7f) + 1;
+            uint16_t skip = indexPixel - _packetFirst;
+            uint16_t countCopy = countPacket - skip;
+            const uint8_t* pSrc = _packet + 1;
+
+            if (countCopy > count)
+            {
+                countCopy = count;
+            }
+
+            if (control & 0x80)
+            {
+                // run, read the pixel once and repeat it from RAM
+                uint8_t* pFirst = pDest;
+
+                copyBytes_P(pDest, pSrc, T_COLOR_FEATURE::PixelSize);
+                pDest += T_COLOR_FEATURE::PixelSize;
+
+                for (uint16_t pixel = 1; pixel < countCopy; pixel++)
+                {
+                    for (size_t b = 0; b < T_COLOR_FEATURE::PixelSize; b++)
+                    {
+                        *pDest++ = pFirst[b];
+                    }
+                }
+            }
+            else
+            {
+                copyBytes_P(pDest, pSrc + skip * T_COLOR_FEATURE::PixelSize, countCopy * T_COLOR_FEATURE::PixelSize);
+                pDest += countCopy * T_COLOR_FEATURE::PixelSize;
+            }
+
+            indexPixel += countCopy;
+            count -= countCopy;
+
+            if (skip + countCopy == countPacket)
+            {
+                nextPacket(control);
+            }
+        }
+
+        return pWindow;
+    }
+
+    void CopyPixels(uint8_t* pPixelDest, const uint8_t* pPixelSrc, uint16_t count)
+    {
+        // source is always decoded pixels in RAM
+        T_COLOR_FEATURE::movePixelsInc(pPixelDest, pPixelSrc, count);
+    }
+
+    typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+    typedef T_COLOR_FEATURE ColorFeature;
+
+    // pixels are in PROGMEM, DecodePixels expands them into the window
+    static const bool IsRamPixels = false;
+
+private:
+    const uint16_t _width;
+    const uint16_t _height;
+    const uint8_t* _rows;
+    const uint8_t* _packets;
+
+    // decode position, the packet and the index of its first pixel
+    mutable const uint8_t* _packet;
+    mutable uint16_t _packetFirst;
+
+    void seekRow(uint16_t row) const
+    {
+        const uint8_t* pOffset = _rows + row * sizeof(uint16_t);
+        uint16_t offset = pgm_read_byte(pOffset) | (pgm_read_byte(pOffset + 1) << 8);
+
+        _packet = _packets + offset;
+        _packetFirst = row * _width;
+    }
+
+    void seek(uint16_t indexPixel) const
+    {
+        if (indexPixel >= PixelCount())
+        {
+            _packetFirst = PixelCount();
+            return;
+        }
+
+        // only walk forward within the same row, otherwise jump using the row table
+        uint16_t row = indexPixel / _width;
+
+        if (indexPixel < _packetFirst || row != _packetFirst / _width)
+        {
+            seekRow(row);
+        }
+
+        for (;;)
+        {
+            uint8_t control = pgm_read_byte(_packet);
+
+            if (indexPixel < _packetFirst + (control & 0x7f) + 1)
+            {
+                break;
+            }
+            nextPacket(control);
+        }
+    }
+
+    void nextPacket(uint8_t control) const
+    {
+        uint16_t countPacket = (control & 0x7f) + 1;
+
+        _packet += 1 + ((control & 0x80) ? 1 : countPacket) * T_COLOR_FEATURE::PixelSize;
+        _packetFirst += countPacket;
+    }
+
+    static void copyBytes_P(uint8_t* pDest, const uint8_t* pSrc, size_t count)
+    {
+        // byte access as packet pixels are not aligned
+        while (count--)
+        {
+            *pDest++ = pgm_read_byte(pSrc++);
+        }
+    }
+};
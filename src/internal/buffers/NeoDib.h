@@ -39,7 +39,9 @@ template<typename T_COLOR_OBJECT> class NeoDib
 public:
     NeoDib(uint16_t countPixels) :
         _countPixels(countPixels),
-        _state(0)
+        _state(0),
+        _dirtyFirst(0),
+        _dirtyLast(0)
     {
         _pixels = (T_COLOR_OBJECT*)malloc(PixelsSize());
         ResetDirty();
@@ -96,7 +98,7 @@ public:
         if (indexPixel < PixelCount())
         {
             _pixels[indexPixel] = color;
-            Dirty();
+            DirtyPixel(indexPixel);
         }
     };
 
@@ -131,7 +133,20 @@ public:
                 countPixels = _countPixels;
             }
 
-            for (uint16_t indexPixel = 0; indexPixel < countPixels; indexPixel++)
+            uint16_t indexPixel = 0;
+
+            // when only pixels changed, just the dirty span needs to be
+            // reprocessed; a dirty shader requires all pixels to be reprocessed
+            if (!shader.IsDirty())
+            {
+                indexPixel = _dirtyFirst;
+                if (countPixels > _dirtyLast)
+                {
+                    countPixels = _dirtyLast;
+                }
+            }
+
+            for (; indexPixel < countPixels; indexPixel++)
             {
                 T_COLOR_OBJECT color = shader.Apply(indexPixel, _pixels[indexPixel]);
                 T_COLOR_FEATURE::applyPixelColor(destBuffer.Pixels, destIndexPixel + indexPixel, color);
@@ -147,18 +162,56 @@ public:
         return  (_state & NEO_DIRTY);
     };
 
+    // marks all pixels as changed
     void Dirty()
     {
         _state |= NEO_DIRTY;
+        _dirtyFirst = 0;
+        _dirtyLast = _countPixels;
+    };
+
+    // marks only the given pixel as changed, extending the dirty span
+    void DirtyPixel(uint16_t indexPixel)
+    {
+        if (!IsDirty())
+        {
+            _state |= NEO_DIRTY;
+            _dirtyFirst = indexPixel;
+            _dirtyLast = indexPixel + 1;
+        }
+        else if (indexPixel < _dirtyFirst)
+        {
+            _dirtyFirst = indexPixel;
+        }
+        else if (indexPixel >= _dirtyLast)
+        {
+            _dirtyLast = indexPixel + 1;
+        }
     };
 
     void ResetDirty()
     {
         _state &= ~NEO_DIRTY;
+        _dirtyFirst = 0;
+        _dirtyLast = 0;
+    };
+
+    // the span of pixels changed since the last ResetDirty(),
+    // DirtyFirst() inclusive to DirtyLast() exclusive
+    uint16_t DirtyFirst() const
+    {
+        return _dirtyFirst;
+    };
+
+    uint16_t DirtyLast() const
+    {
+        return _dirtyLast;
     };
 
 private:
     const uint16_t _countPixels; // Number of RGB LEDs in strip
     T_COLOR_OBJECT* _pixels;
     uint8_t _state;     // internal state
+    uint16_t _dirtyFirst; // first pixel changed
+    uint16_t _dirtyLast; // one past the last pixel changed
 };
\ No newline at end of file
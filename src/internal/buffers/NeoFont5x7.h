@@ -0,0 +1,41 @@
+/*-------------------------------------------------------------------------
+NeoFont5x7 is a 5 by 7 pixel bitmap font for NeoTextStrip
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoFont5x7 is the classic 5 by 7 pixel font for the printable ascii
+// characters, ' ' to '~', others show as a blank.
+// A font for NeoTextStrip provides the Width and Height of its glyphs and 
+// GetColumn, which returns one column of a glyph as a bitmask with bit 0 as
+// the top row, so the Height is at most 8.
+//
+class NeoFont5x7
+{
+public:
+    static const uint8_t Width = 5;
+    static const uint8_t Height = 7;
+
+    static uint8_t GetColumn(char glyph, uint8_t column);
+};
@@ -0,0 +1,371 @@
+/*-------------------------------------------------------------------------
+NeoSpriteAtlas - a bitmap holding sprites at arbitrary rectangles with
+optional transparency using a color key or a 1 bit mask
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// a sprite location within the atlas bitmap
+struct NeoSpriteRect
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+};
+
+// T_BUFFER_METHOD - one of
+//      NeoBufferMethod
+//      NeoBufferProgmemMethod
+//
+// The transparency is stored as opaque runs per sprite row, so a transparent
+// Blt only copies the opaque spans without comparing pixels.
+// The runs for a sprite are stored as a stream of uint16_t values, for each row
+// the count of runs followed by the pairs of x offset and length of each run
+//
+template<typename T_BUFFER_METHOD> class NeoSpriteAtlas
+{
+public:
+    // sprites - array of sprite rectangles in RAM, must remain valid for the
+    // life of the atlas
+    NeoSpriteAtlas(uint16_t width,
+        uint16_t height,
+        PGM_VOID_P pixels,
+        const NeoSpriteRect* sprites,
+        uint16_t spriteCount) :
+        _method(width, height, pixels),
+        _sprites(sprites),
+        _spriteCount(spriteCount),
+        _spriteRuns(nullptr),
+        _runs(nullptr)
+    {
+    }
+
+    ~NeoSpriteAtlas()
+    {
+        ClearMask();
+    }
+
+    operator NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature>()
+    {
+        return _method;
+    }
+
+    uint16_t SpriteCount() const
+    {
+        return _spriteCount;
+    };
+
+    uint16_t SpriteWidth(uint16_t indexSprite) const
+    {
+        return (indexSprite < _spriteCount) ? _sprites[indexSprite].width : 0;
+    };
+
+    uint16_t SpriteHeight(uint16_t indexSprite) const
+    {
+        return (indexSprite < _spriteCount) ? _sprites[indexSprite].height : 0;
+    };
+
+    void SetPixelColor(uint16_t indexSprite,
+        int16_t x,
+        int16_t y,
+        typename T_BUFFER_METHOD::ColorObject color)
+    {
+        _method.SetPixelColor(pixelIndex(indexSprite, x, y), color);
+    };
+
+    typename T_BUFFER_METHOD::ColorObject GetPixelColor(uint16_t indexSprite,
+        int16_t x,
+        int16_t y) const
+    {
+        return _method.GetPixelColor(pixelIndex(indexSprite, x, y));
+    };
+
+    void ClearTo(typename T_BUFFER_METHOD::ColorObject color)
+    {
+        _method.ClearTo(color);
+    };
+
+    // build the opaque runs treating all pixels matching colorKey as transparent,
+    // call again if the pixels of the atlas are modified; returns false if
+    // out of memory or the runs of all sprites need more than 65535 values
+    bool BuildMask(typename T_BUFFER_METHOD::ColorObject colorKey)
+    {
+        return buildRuns([this, colorKey](int16_t x, int16_t y)
+            {
+                return !(_method.GetPixelColor(x, y) == colorKey);
+            });
+    }
+
+    // build the opaque runs from a 1 bit per pixel mask stored in PROGMEM,
+    // the mask covers the whole atlas with each row padded to a whole byte,
+    // the most significant bit is the left most pixel and a set bit is opaque
+    bool BuildMask_P(PGM_VOID_P mask)
+    {
+        const uint8_t* pMask = reinterpret_cast<const uint8_t*>(mask);
+        const uint16_t sizeRow = (_method.Width() + 7) / 8;
+
+        return buildRuns([pMask, sizeRow](int16_t x, int16_t y)
+            {
+                uint8_t bits = pgm_read_byte(pMask + y * sizeRow + x / 8);
+                return (bits & (0x80 >> (x % 8))) != 0;
+            });
+    }
+
+    // release the runs, sprites are then copied opaque
+    void ClearMask()
+    {
+        free(_runs);
+        free(_spriteRuns);
+        _runs = nullptr;
+        _spriteRuns = nullptr;
+    }
+
+    bool HasMask() const
+    {
+        return (_runs != nullptr);
+    }
+
+    // Blt to a row major destination of the given width, like a NeoBuffer
+    // or a strip used as a single row, where each run is copied at once
+    void Blt(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        uint16_t destWidth,
+        int16_t x,
+        int16_t y,
+        uint16_t indexSprite)
+    {
+        if (indexSprite >= _spriteCount || destWidth == 0)
+        {
+            return;
+        }
+
+        const NeoSpriteRect& sprite = _sprites[indexSprite];
+        const int16_t destHeight = destBuffer.PixelCount() / destWidth;
+        const uint16_t* pRuns = spriteRuns(indexSprite);
+
+        for (int16_t row = 0; row < static_cast<int16_t>(sprite.height); row++)
+        {
+            int16_t yDest = y + row;
+            uint16_t countRuns = pRuns ? *pRuns++ : 1;
+            const uint16_t* pRowRuns = pRuns;
+
+            if (pRuns)
+            {
+                pRuns += countRuns * 2;
+            }
+
+            if (yDest < 0 || yDest >= destHeight)
+            {
+                continue;
+            }
+
+            for (uint16_t run = 0; run < countRuns; run++)
+            {
+                int16_t xRun = pRowRuns ? *pRowRuns++ : 0;
+                int16_t countRun = pRowRuns ? *pRowRuns++ : sprite.width;
+                int16_t xDest = x + xRun;
+
+                // clip to the destination row
+                if (xDest < 0)
+                {
+                    xRun -= xDest;
+                    countRun += xDest;
+                    xDest = 0;
+                }
+                if (xDest + countRun > static_cast<int16_t>(destWidth))
+                {
+                    countRun = destWidth - xDest;
+                }
+
+                if (countRun > 0)
+                {
+                    uint8_t* pDest = T_BUFFER_METHOD::ColorFeature::getPixelAddress(destBuffer.Pixels,
+                        yDest * destWidth + xDest);
+                    const uint8_t* pSrc = T_BUFFER_METHOD::ColorFeature::getPixelAddress(_method.Pixels(),
+                        pixelIndex(indexSprite, xRun, row));
+
+                    _method.CopyPixels(pDest, pSrc, countRun);
+                }
+            }
+        }
+    }
+
+    // Blt through a layout map, only the pixels of the opaque runs are copied
+    void Blt(NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        int16_t x,
+        int16_t y,
+        uint16_t indexSprite,
+        LayoutMapCallback layoutMap)
+    {
+        if (indexSprite >= _spriteCount)
+        {
+            return;
+        }
+
+        const NeoSpriteRect& sprite = _sprites[indexSprite];
+        const uint16_t destPixelCount = destBuffer.PixelCount();
+        const uint16_t* pRuns = spriteRuns(indexSprite);
+
+        for (int16_t row = 0; row < static_cast<int16_t>(sprite.height); row++)
+        {
+            uint16_t countRuns = pRuns ? *pRuns++ : 1;
+
+            for (uint16_t run = 0; run < countRuns; run++)
+            {
+                int16_t xRun = pRuns ? *pRuns++ : 0;
+                int16_t xEnd = xRun + (pRuns ? *pRuns++ : sprite.width);
+
+                for (; xRun < xEnd; xRun++)
+                {
+                    uint16_t indexDest = layoutMap(x + xRun, y + row);
+
+                    if (indexDest < destPixelCount)
+                    {
+                        const uint8_t* pSrc = T_BUFFER_METHOD::ColorFeature::getPixelAddress(_method.Pixels(),
+                            pixelIndex(indexSprite, xRun, row));
+                        uint8_t* pDest = T_BUFFER_METHOD::ColorFeature::getPixelAddress(destBuffer.Pixels, indexDest);
+
+                        _method.CopyPixels(pDest, pSrc, 1);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    T_BUFFER_METHOD _method;
+
+    const NeoSpriteRect* _sprites;
+    const uint16_t _spriteCount;
+    uint16_t* _spriteRuns; // offset into _runs for each sprite
+    uint16_t* _runs;
+
+    const uint16_t* spriteRuns(uint16_t indexSprite) const
+    {
+        return (_runs) ? (_runs + _spriteRuns[indexSprite]) : nullptr;
+    }
+
+    uint16_t pixelIndex(uint16_t indexSprite,
+        int16_t x,
+        int16_t y) const
+    {
+        uint16_t result = PixelIndex_OutOfBounds;
+
+        if (indexSprite < _spriteCount &&
+            x >= 0 &&
+            static_cast<uint16_t>(x) < _sprites[indexSprite].width &&
+            y >= 0 &&
+            static_cast<uint16_t>(y) < _sprites[indexSprite].height)
+        {
+            const NeoSpriteRect& sprite = _sprites[indexSprite];
+
+            result = (sprite.x + x) + (sprite.y + y) * _method.Width();
+        }
+        return result;
+    }
+
+    // scans every sprite twice, first to size the runs and then to store them
+    template <typename T_IS_OPAQUE> bool buildRuns(T_IS_OPAQUE isOpaque)
+    {
+        ClearMask();
+
+        _spriteRuns = static_cast<uint16_t*>(malloc(_spriteCount * sizeof(uint16_t)));
+        if (_spriteRuns == nullptr)
+        {
+            return false;
+        }
+
+        // the sprite offsets into the runs are uint16_t
+        uint32_t countValues = scanRuns(isOpaque, nullptr);
+
+        if (countValues > 0xffff)
+        {
+            ClearMask();
+            return false;
+        }
+
+        _runs = static_cast<uint16_t*>(malloc(countValues * sizeof(uint16_t)));
+        if (_runs == nullptr)
+        {
+            ClearMask();
+            return false;
+        }
+
+        scanRuns(isOpaque, _runs);
+        return true;
+    }
+
+    template <typename T_IS_OPAQUE> uint32_t scanRuns(T_IS_OPAQUE& isOpaque, uint16_t* pRuns)
+    {
+        uint32_t countValues = 0;
+
+        for (uint16_t indexSprite = 0; indexSprite < _spriteCount; indexSprite++)
+        {
+            const NeoSpriteRect& sprite = _sprites[indexSprite];
+
+            _spriteRuns[indexSprite] = countValues;
+
+            for (uint16_t y = 0; y < sprite.height; y++)
+            {
+                uint32_t indexCount = countValues++;
+                uint16_t countRuns = 0;
+                uint16_t x = 0;
+
+                while (x < sprite.width)
+                {
+                    // skip transparent
+                    while (x < sprite.width && !isOpaque(sprite.x + x, sprite.y + y))
+                    {
+                        x++;
+                    }
+
+                    uint16_t xRun = x;
+
+                    while (x < sprite.width && isOpaque(sprite.x + x, sprite.y + y))
+                    {
+                        x++;
+                    }
+
+                    if (x > xRun)
+                    {
+                        if (pRuns)
+                        {
+                            pRuns[countValues] = xRun;
+                            pRuns[countValues + 1] = x - xRun;
+                        }
+                        countValues += 2;
+                        countRuns++;
+                    }
+                }
+
+                if (pRuns)
+                {
+                    pRuns[indexCount] = countRuns;
+                }
+            }
+        }
+
+        return countValues;
+    }
+};
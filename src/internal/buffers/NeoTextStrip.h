@@ -0,0 +1,191 @@
+/*-------------------------------------------------------------------------
+NeoTextStrip rasterizes text once and scrolls it into a NeoBuffer
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoTextStrip rasterizes a string once with a bitmap font into a strip of
+// one bit columns, one byte per column, so scrolling text only copies a 
+// window of the strip each frame rather than looking up every glyph again.
+// The window is drawn into a NeoBuffer with a foreground and background 
+// color; the position is in 1/256 of a column so the text can move by less 
+// than a pixel per frame, the partly covered pixels are blended.
+//
+//    NeoTextStrip<> text;
+//    text.SetText("Hello");
+//    text.Render(image, position, RgbColor(128, 0, 0), RgbColor(0));
+//
+template <typename T_FONT = NeoFont5x7> class NeoTextStrip
+{
+public:
+    static const int32_t ColumnUnit = 256;
+
+    NeoTextStrip() :
+        _columns(nullptr),
+        _countColumns(0)
+    {
+    }
+
+    ~NeoTextStrip()
+    {
+        free(_columns);
+    }
+
+    // ------------------------------------------------------------------------
+    // SetText rasterizes text with spacing blank columns between glyphs,
+    // returning false if there isn't the memory for it
+    // ------------------------------------------------------------------------
+    bool SetText(const char* text, uint8_t spacing = 1)
+    {
+        size_t countGlyphs = (text != nullptr) ? strlen(text) : 0;
+        size_t countColumns = countGlyphs ? 
+            countGlyphs * (T_FONT::Width + spacing) - spacing : 
+            0;
+
+        if (countColumns > 0xffff)
+        {
+            return false;
+        }
+
+        if (countColumns != _countColumns)
+        {
+            uint8_t* columns = static_cast<uint8_t*>(realloc(_columns, countColumns));
+
+            if (columns == nullptr && countColumns)
+            {
+                return false;
+            }
+            _columns = columns;
+            _countColumns = countColumns;
+        }
+
+        uint8_t* column = _columns;
+
+        for (size_t glyph = 0; glyph < countGlyphs; glyph++)
+        {
+            if (glyph)
+            {
+                memset(column, 0, spacing);
+                column += spacing;
+            }
+            for (uint8_t x = 0; x < T_FONT::Width; x++)
+            {
+                *column++ = T_FONT::GetColumn(text[glyph], x);
+            }
+        }
+        return true;
+    }
+
+    bool SetText(const String& text, uint8_t spacing = 1)
+    {
+        return SetText(text.c_str(), spacing);
+    }
+
+    uint16_t ColumnCount() const
+    {
+        return _countColumns;
+    }
+
+    uint8_t Height() const
+    {
+        return T_FONT::Height;
+    }
+
+    // ------------------------------------------------------------------------
+    // GetColumn returns the bitmask of a column, bit 0 is the top row;
+    // columns outside the text are blank
+    // ------------------------------------------------------------------------
+    uint8_t GetColumn(int32_t column) const
+    {
+        if (column < 0 || column >= _countColumns)
+        {
+            return 0;
+        }
+        return _columns[column];
+    }
+
+    // ------------------------------------------------------------------------
+    // Render draws a window of the text into the buffer
+    // buffer - the NeoBuffer to draw into
+    // position - the text column at the left edge of the window, in 
+    //     ColumnUnit; negative or past the end shows blank columns so the 
+    //     text can scroll in from the right, like from -width * ColumnUnit
+    //     up to ColumnCount() * ColumnUnit 
+    // foreground, background - the colors of the text and around it
+    // x, y - the top left of the window in the buffer
+    // width - the columns in the window, by default to the buffer edge
+    // ------------------------------------------------------------------------
+    template <typename T_BUFFER_METHOD> void Render(NeoBuffer<T_BUFFER_METHOD>& buffer,
+        int32_t position,
+        typename T_BUFFER_METHOD::ColorObject foreground,
+        typename T_BUFFER_METHOD::ColorObject background,
+        int16_t x = 0,
+        int16_t y = 0)
+    {
+        Render(buffer, position, foreground, background, x, y, buffer.Width() - x);
+    }
+
+    template <typename T_BUFFER_METHOD> void Render(NeoBuffer<T_BUFFER_METHOD>& buffer,
+        int32_t position,
+        typename T_BUFFER_METHOD::ColorObject foreground,
+        typename T_BUFFER_METHOD::ColorObject background,
+        int16_t x,
+        int16_t y,
+        int16_t width)
+    {
+        typedef typename T_BUFFER_METHOD::ColorObject ColorObject;
+
+        // arithmetic shift so negative positions round down
+        int32_t column = position >> 8;
+        uint8_t fraction = position & 0xff;
+
+        // a pixel shows the column under it and the next one by the 
+        // fraction, the four cases are blended once here
+        ColorObject colors[4] = {
+            background,
+            ColorObject::LinearBlend(background, foreground, NeoProgress16((255 - fraction) * 257)),
+            ColorObject::LinearBlend(background, foreground, NeoProgress16(fraction * 257)),
+            foreground
+        };
+
+        uint8_t left = GetColumn(column);
+
+        for (int16_t windowX = 0; windowX < width; windowX++)
+        {
+            uint8_t right = GetColumn(++column);
+
+            for (uint8_t row = 0; row < T_FONT::Height; row++)
+            {
+                uint8_t coverage = ((left >> row) & 0x01) | (((right >> row) & 0x01) << 1);
+
+                buffer.SetPixelColor(x + windowX, y + row, colors[coverage]);
+            }
+            left = right;
+        }
+    }
+
+private:
+    uint8_t* _columns;
+    uint16_t _countColumns;
+};
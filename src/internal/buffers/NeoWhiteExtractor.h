@@ -0,0 +1,263 @@
+/*-------------------------------------------------------------------------
+NeoWhiteExtractor converts RGB pixels to pixels with white elements
+by extracting the white from the RGB
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// Strategies for how much white is extracted and what is left in the RGB
+//
+// NeoWhiteExtractSubtract - all the common white is moved to the white
+//      elements, the color is kept the same
+class NeoWhiteExtractSubtract
+{
+public:
+    static const bool SubtractWhite = true;
+
+    static uint16_t Level(uint16_t white, uint16_t)
+    {
+        return white;
+    }
+};
+
+// NeoWhiteExtractAdd - the common white is added by the white elements 
+//      while the RGB is kept, brighter but less saturated
+class NeoWhiteExtractAdd
+{
+public:
+    static const bool SubtractWhite = false;
+
+    static uint16_t Level(uint16_t white, uint16_t)
+    {
+        return white;
+    }
+};
+
+// NeoWhiteExtractSaturation - less white is moved as the color becomes 
+//      more saturated, so only pastels and whites use the white elements
+class NeoWhiteExtractSaturation
+{
+public:
+    static const bool SubtractWhite = true;
+
+    static uint16_t Level(uint16_t white, uint16_t largest)
+    {
+        return (largest == 0) ? 0 : static_cast<uint32_t>(white) * white / largest;
+    }
+};
+
+// NeoWhiteExtractor converts RGB pixels to RGBW, RGBWW, or RGBWWW pixels
+// using only integer math. Each white element has a white point, the RGB
+// color it matches, so warm or cool whites are extracted correctly; when
+// there are several whites each extracts from what the previous ones left.
+// It can convert spans of color objects or feature pixels, or be used as
+// a shader with NeoBuffer::Render to convert while copying to the bus.
+//
+// T_SRC_FEATURE - the RGB feature of the source, like NeoRgbFeature
+// T_DEST_FEATURE - the feature of the destination, like NeoGrbwFeature
+// T_STRATEGY - 
+//      NeoWhiteExtractSubtract
+//      NeoWhiteExtractAdd
+//      NeoWhiteExtractSaturation
+//
+// examples:
+//  NeoWhiteExtractor<NeoGrbFeature, NeoGrbwFeature> extractor;
+//  extractor.SetWhitePoint(0, RgbColor(255, 224, 180)); // a warm white
+//  image.Render(strip, extractor); // NeoBuffer<NeoBufferMethod<NeoGrbFeature>>
+//
+template<typename T_SRC_FEATURE, 
+    typename T_DEST_FEATURE, 
+    typename T_STRATEGY = NeoWhiteExtractSubtract> class NeoWhiteExtractor : public NeoShaderBase
+{
+public:
+    typedef T_DEST_FEATURE DestFeature;
+    typedef typename T_SRC_FEATURE::ColorObject SrcColorObject;
+    typedef typename T_DEST_FEATURE::ColorObject DestColorObject;
+
+    static_assert(SrcColorObject::Count == 3, "T_SRC_FEATURE must be an RGB feature");
+    static_assert(DestColorObject::Count > 3, "T_DEST_FEATURE must have white elements");
+    static_assert(SrcColorObject::Max == DestColorObject::Max, "T_SRC_FEATURE and T_DEST_FEATURE must use the same element size");
+
+    static const uint8_t WhiteCount = DestColorObject::Count - 3;
+
+    // strength - how much of the extracted white is used (0-255)
+    NeoWhiteExtractor(uint8_t strength = 255)
+    {
+        SetStrength(strength);
+        for (uint8_t white = 0; white < WhiteCount; white++)
+        {
+            SetWhitePoint(white, SrcColorObject(SrcColorObject::Max));
+        }
+    }
+
+    // indexWhite - 0 for the first white element (W, WW, or W1)
+    // whitePoint - the RGB color that matches the white element, the elements
+    //      are normalized so the largest is full and the smallest is limited
+    //      to 1/16 of full
+    void SetWhitePoint(uint8_t indexWhite, const SrcColorObject& whitePoint)
+    {
+        if (indexWhite >= WhiteCount)
+        {
+            return;
+        }
+
+        uint32_t largest = 1;
+
+        for (uint8_t element = 0; element < 3; element++)
+        {
+            if (whitePoint[element] > largest)
+            {
+                largest = whitePoint[element];
+            }
+        }
+
+        for (uint8_t element = 0; element < 3; element++)
+        {
+            uint32_t value = whitePoint[element] * static_cast<uint32_t>(Max) / largest;
+
+            if (value < Max / 16)
+            {
+                value = Max / 16;
+            }
+
+            // white from an element is element * _inverse >> 8, rounded up
+            // so an element that matches the white point is fully used
+            _inverse[indexWhite][element] = ((static_cast<uint32_t>(Max) << 8) + value - 1) / value;
+            // the element used by white is white * _weight >> 16
+            _weight[indexWhite][element] = (value << 16) / Max;
+        }
+        Dirty();
+    }
+
+    void SetStrength(uint8_t strength)
+    {
+        _strength = strength;
+        Dirty();
+    }
+
+    uint8_t Strength() const
+    {
+        return _strength;
+    }
+
+    DestColorObject Convert(const SrcColorObject& color) const
+    {
+        uint16_t remaining[3] = { color[0], color[1], color[2] };
+        DestColorObject result;
+
+        for (uint8_t white = 0; white < WhiteCount; white++)
+        {
+            const uint16_t* inverse = _inverse[white];
+            uint32_t smallest = Max;
+            uint32_t largest = 0;
+
+            for (uint8_t element = 0; element < 3; element++)
+            {
+                uint32_t level = (static_cast<uint32_t>(remaining[element]) * inverse[element]) >> 8;
+
+                if (level < smallest)
+                {
+                    smallest = level;
+                }
+                if (level > largest)
+                {
+                    largest = level;
+                }
+            }
+
+            if (largest > Max)
+            {
+                largest = Max;
+            }
+
+            uint32_t level = T_STRATEGY::Level(smallest, largest);
+
+            level = (level * (static_cast<uint16_t>(_strength) + 1)) >> 8;
+            result[3 + white] = level;
+
+            // remove what this white provides, so the next white only 
+            // extracts from what is left
+            for (uint8_t element = 0; element < 3; element++)
+            {
+                uint16_t used = (level * _weight[white][element] + 0x8000) >> 16;
+
+                remaining[element] = (used < remaining[element]) ? (remaining[element] - used) : 0;
+            }
+        }
+
+        for (uint8_t element = 0; element < 3; element++)
+        {
+            result[element] = T_STRATEGY::SubtractWhite ? remaining[element] : color[element];
+        }
+        return result;
+    }
+
+    // converts count colors into pPixels starting at indexPixel
+    void Convert(uint8_t* pPixels, 
+        uint16_t indexPixel, 
+        const SrcColorObject* colors, 
+        uint16_t count) const
+    {
+        while (count--)
+        {
+            T_DEST_FEATURE::applyPixelColor(pPixels, indexPixel++, Convert(*colors++));
+        }
+    }
+
+    // converts count pixels in T_SRC_FEATURE format into T_DEST_FEATURE format
+    void ConvertPixels(uint8_t* pDest, const uint8_t* pSrc, uint16_t count) const
+    {
+        for (uint16_t index = 0; index < count; index++)
+        {
+            T_DEST_FEATURE::applyPixelColor(pDest, 
+                index, 
+                Convert(T_SRC_FEATURE::retrievePixelColor(pSrc, index)));
+        }
+    }
+
+    // converts count pixels in T_SRC_FEATURE format stored in PROGMEM
+    void ConvertPixels_P(uint8_t* pDest, PGM_VOID_P pSrc, uint16_t count) const
+    {
+        for (uint16_t index = 0; index < count; index++)
+        {
+            T_DEST_FEATURE::applyPixelColor(pDest, 
+                index, 
+                Convert(T_SRC_FEATURE::retrievePixelColor_P(pSrc, index)));
+        }
+    }
+
+    // used by NeoBuffer::Render, which always passes the source in RAM
+    void Apply(uint16_t, uint8_t* pDest, const uint8_t* pSrc)
+    {
+        ConvertPixels(pDest, pSrc, 1);
+    }
+
+private:
+    static const uint16_t Max = SrcColorObject::Max;
+
+    uint8_t _strength;
+    uint16_t _inverse[WhiteCount][3];
+    uint32_t _weight[WhiteCount][3];
+};
@@ -0,0 +1,196 @@
+/*-------------------------------------------------------------------------
+Hsl32Color provides a color object that stores Hue, Saturation, Lightness
+as integers so that it can be converted to rgb without floating point
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// Hsl32Color represents a color object that is represented by Hue, Saturation, 
+// Lightness component values using integers, a 16 bit hue and 8 bit saturation
+// and lightness.  Conversion to rgb uses only integer math, which is 
+// much faster than HslColor on platforms without a floating point unit.
+// ------------------------------------------------------------------------
+struct Hsl32Color
+{
+    // ------------------------------------------------------------------------
+    // Construct a Hsl32Color using H (0 - 65535), S (0 - 255), L (0 - 255) values
+    // the hue wraps so 65536 would be the same as 0 (red)
+    // ------------------------------------------------------------------------
+    Hsl32Color(uint16_t h, uint8_t s, uint8_t l) :
+        H(h), S(s), L(l)
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsl32Color using HslColor
+    // ------------------------------------------------------------------------
+    explicit Hsl32Color(const HslColor& color) :
+        H(static_cast<uint16_t>(static_cast<int32_t>(color.H * 65536.0f))),
+        S(static_cast<uint8_t>(color.S * 255.0f + 0.5f)),
+        L(static_cast<uint8_t>(color.L * 255.0f + 0.5f))
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsl32Color that will have its values set in latter operations
+    // CAUTION:  The H,S,L members are not initialized and may not be consistent
+    // ------------------------------------------------------------------------
+    Hsl32Color()
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // ConvertToRgb converts the 16 bit hue, saturation, and lightness into
+    // 16 bit red, green, and blue; the error is within 2 of the float math
+    // ------------------------------------------------------------------------
+    static void ConvertToRgb(uint16_t h,
+        uint16_t s,
+        uint16_t l,
+        uint16_t* r,
+        uint16_t* g,
+        uint16_t* b)
+    {
+        if (s == 0 || l == 0)
+        {
+            *r = *g = *b = l; // achromatic or black
+            return;
+        }
+
+        uint32_t h6 = static_cast<uint32_t>(h) * 6;
+        uint16_t f = h6 & 0xffff;
+        uint8_t sector = h6 >> 16;
+        uint16_t c = (l < 0x8000) ?
+            RgbColorBase::_Scale16(l * 2, s) :
+            RgbColorBase::_Scale16((0xffff - l) * 2, s);
+        uint16_t m = l - c / 2;
+        uint16_t x = RgbColorBase::_Scale16(c, (sector & 0x01) ? 0xffff - f : f);
+
+        c += m;
+        x += m;
+
+        switch (sector)
+        {
+        case 0:
+            *r = c;
+            *g = x;
+            *b = m;
+            break;
+        case 1:
+            *r = x;
+            *g = c;
+            *b = m;
+            break;
+        case 2:
+            *r = m;
+            *g = c;
+            *b = x;
+            break;
+        case 3:
+            *r = m;
+            *g = x;
+            *b = c;
+            break;
+        case 4:
+            *r = x;
+            *g = m;
+            *b = c;
+            break;
+        default:
+            *r = c;
+            *g = m;
+            *b = x;
+            break;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // ToPixels converts a span of colors and stores them into the pixel buffer
+    // in the native format of the feature
+    // pPixels - the pixels of a NeoBufferContext or the bus
+    // indexPixel - the first pixel to store into
+    // colors - the source colors
+    // count - the number of colors/pixels
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_FEATURE> static void ToPixels(uint8_t* pPixels,
+        uint16_t indexPixel,
+        const Hsl32Color* colors,
+        uint16_t count)
+    {
+        while (count--)
+        {
+            uint16_t r;
+            uint16_t g;
+            uint16_t b;
+
+            ConvertToRgb(colors->H, colors->S * 257, colors->L * 257, &r, &g, &b);
+            colors++;
+
+            T_COLOR_FEATURE::applyPixelColor(pPixels,
+                indexPixel++,
+                RgbColorBase::_FromRgb16<typename T_COLOR_FEATURE::ColorObject>(r, g, b));
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // FillHueGradient stores a span of colors with the same saturation and
+    // lightness where the hue changes by hueDelta for each pixel
+    // pPixels - the pixels of a NeoBufferContext or the bus
+    // indexPixel - the first pixel to store into
+    // count - the number of pixels
+    // first - the color of the first pixel
+    // hueDelta - the change in hue for each pixel, the hue wraps around
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_FEATURE> static void FillHueGradient(uint8_t* pPixels,
+        uint16_t indexPixel,
+        uint16_t count,
+        const Hsl32Color& first,
+        int16_t hueDelta)
+    {
+        uint16_t h = first.H;
+        uint16_t s = first.S * 257;
+        uint16_t l = first.L * 257;
+
+        while (count--)
+        {
+            uint16_t r;
+            uint16_t g;
+            uint16_t b;
+
+            ConvertToRgb(h, s, l, &r, &g, &b);
+            h += hueDelta;
+
+            T_COLOR_FEATURE::applyPixelColor(pPixels,
+                indexPixel++,
+                RgbColorBase::_FromRgb16<typename T_COLOR_FEATURE::ColorObject>(r, g, b));
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Hue (0 - 65535), Saturation (0 - 255), Lightness (0 - 255) color members 
+    // ------------------------------------------------------------------------
+    uint16_t H;
+    uint8_t S;
+    uint8_t L;
+};
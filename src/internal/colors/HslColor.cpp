@@ -27,6 +27,7 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "Rgb48Color.h"
@@ -26,6 +26,7 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "HtmlColor.h"
@@ -61,3 +62,86 @@ size_t HtmlColor::ToNumericalString(char* buf, size_t bufSize) const
     }
     return 0;
 }
+
+// compares a name that is not null terminated against a PROGMEM name of
+// the same length, returns <0, 0, >0 like strcmp
+static int compareName(const char* name, PGM_P nameP, size_t nameLength)
+{
+    for (size_t indexChar = 0; indexChar < nameLength; indexChar++)
+    {
+        int result = tolower(name[indexChar]) - static_cast<int>(pgm_read_byte(nameP + indexChar));
+
+        if (result != 0)
+        {
+            return result;
+        }
+    }
+    return 0;
+}
+
+const HtmlColorPair* HtmlColorPairIndex::FindName(const char* name, size_t nameLength) const
+{
+    if (nameLength == 0 || nameLength > MAX_HTML_COLOR_NAME_LEN)
+    {
+        return nullptr;
+    }
+
+    // only names of the same length are candidates
+    uint8_t first = pgm_read_byte(LengthStarts + nameLength);
+    uint8_t last = pgm_read_byte(LengthStarts + nameLength + 1);
+
+    while (first < last)
+    {
+        uint8_t middle = first + (last - first) / 2;
+        const HtmlColorPair* colorPair = &Pairs[pgm_read_byte(ByLength + middle)];
+        PGM_P searchName = reinterpret_cast<PGM_P>(pgm_read_ptr(&(colorPair->Name)));
+        int result = compareName(name, searchName, nameLength);
+
+        if (result == 0)
+        {
+            return colorPair;
+        }
+        else if (result < 0)
+        {
+            last = middle;
+        }
+        else
+        {
+            first = middle + 1;
+        }
+    }
+    return nullptr;
+}
+
+const HtmlColorPair* HtmlColorPairIndex::FindColor(uint32_t color) const
+{
+    // lower bound, so the first of several names for a color is found
+    uint8_t first = 0;
+    uint8_t last = Count;
+
+    while (first < last)
+    {
+        uint8_t middle = first + (last - first) / 2;
+        const HtmlColorPair* colorPair = &Pairs[pgm_read_byte(ByColor + middle)];
+
+        if (pgm_read_dword(&colorPair->Color) < color)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    if (first < Count)
+    {
+        const HtmlColorPair* colorPair = &Pairs[pgm_read_byte(ByColor + first)];
+
+        if (pgm_read_dword(&colorPair->Color) == color)
+        {
+            return colorPair;
+        }
+    }
+    return nullptr;
+}
@@ -41,6 +41,32 @@ struct HtmlColorPair
     uint32_t Color;
 };
 
+// ------------------------------------------------------------------------
+// HtmlColorPairIndex holds the PROGMEM lookup tables over a sorted
+// name/color pair table so that names and colors are found with a short
+// binary search rather than scanning the whole table
+//
+// ByLength - pair indexes sorted by name length and then by name
+// LengthStarts - first entry in ByLength for each name length, 
+//      MAX_HTML_COLOR_NAME_LEN + 2 entries
+// ByColor - pair indexes sorted by color and then by index
+//
+// The names in the pair table must be lower case
+// ------------------------------------------------------------------------
+struct HtmlColorPairIndex
+{
+    const HtmlColorPair* Pairs;
+    const uint8_t* ByLength;
+    const uint8_t* LengthStarts;
+    const uint8_t* ByColor;
+    uint8_t Count;
+
+    // name is not null terminated, nameLength is the count of chars to match
+    const HtmlColorPair* FindName(const char* name, size_t nameLength) const;
+    // returns the first pair in the table with the color
+    const HtmlColorPair* FindColor(uint32_t color) const;
+};
+
 // ------------------------------------------------------------------------
 // HtmlShortColorNames is a template class used for Parse and ToString
 // ------------------------------------------------------------------------
@@ -49,6 +75,8 @@ class HtmlShortColorNames
 public:
     static const HtmlColorPair* Pair(uint8_t index);
     static uint8_t Count();
+    static const HtmlColorPair* FindName(const char* name, size_t nameLength);
+    static const HtmlColorPair* FindColor(uint32_t color);
 };
 
 // ------------------------------------------------------------------------
@@ -59,6 +87,80 @@ class HtmlColorNames
 public:
     static const HtmlColorPair* Pair(uint8_t index);
     static uint8_t Count();
+    static const HtmlColorPair* FindName(const char* name, size_t nameLength);
+    static const HtmlColorPair* FindColor(uint32_t color);
+};
+
+// ------------------------------------------------------------------------
+// HtmlColorNamesLookup is used by Parse and ToString to find a pair in a
+// T_HTMLCOLORNAMES class.  It uses the FindName and FindColor of the class
+// when it provides them, and otherwise scans Pair() for Count() entries so
+// custom name classes that only provide those still work
+// ------------------------------------------------------------------------
+template <typename T_HTMLCOLORNAMES> class HtmlColorNamesLookup
+{
+public:
+    // name is not null terminated, nameLength is the count of chars to match
+    static const HtmlColorPair* FindName(const char* name, size_t nameLength)
+    {
+        return findName<T_HTMLCOLORNAMES>(name, nameLength, 0);
+    }
+
+    // returns the first pair with the color
+    static const HtmlColorPair* FindColor(uint32_t color)
+    {
+        return findColor<T_HTMLCOLORNAMES>(color, 0);
+    }
+
+private:
+    // the int overloads are preferred when T provides the method
+    template <typename T> static auto findName(const char* name, size_t nameLength, int)
+        -> decltype(T::FindName(name, nameLength))
+    {
+        return T::FindName(name, nameLength);
+    }
+
+    template <typename T> static const HtmlColorPair* findName(const char* name, size_t nameLength, long)
+    {
+        for (uint8_t indexName = 0; indexName < T::Count(); ++indexName)
+        {
+            const HtmlColorPair* colorPair = T::Pair(indexName);
+            PGM_P searchName = reinterpret_cast<PGM_P>(pgm_read_ptr(&(colorPair->Name)));
+            size_t indexChar = 0;
+
+            while (indexChar < nameLength &&
+                tolower(name[indexChar]) == tolower(pgm_read_byte(searchName + indexChar)))
+            {
+                indexChar++;
+            }
+
+            if (indexChar == nameLength && pgm_read_byte(searchName + indexChar) == '\0')
+            {
+                return colorPair;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T> static auto findColor(uint32_t color, int)
+        -> decltype(T::FindColor(color))
+    {
+        return T::FindColor(color);
+    }
+
+    template <typename T> static const HtmlColorPair* findColor(uint32_t color, long)
+    {
+        for (uint8_t indexName = 0; indexName < T::Count(); ++indexName)
+        {
+            const HtmlColorPair* colorPair = T::Pair(indexName);
+
+            if (pgm_read_dword(&colorPair->Color) == color)
+            {
+                return colorPair;
+            }
+        }
+        return nullptr;
+    }
 };
 
 // ------------------------------------------------------------------------
@@ -201,42 +303,21 @@ struct HtmlColor
                 // parse a standard name for the color
                 //
 
-                // the normal list is small enough a binary search isn't interesting,
-                for (uint8_t indexName = 0; indexName < T_HTMLCOLORNAMES::Count(); ++indexName)
+                // the name ends at the first non alpha numeric, so only the
+                // names of exactly that length need to be searched
+                size_t nameLength = 0;
+
+                while (nameLength < nameSize && isalnum(name[nameLength]))
                 {
-                    const HtmlColorPair* colorPair = T_HTMLCOLORNAMES::Pair(indexName);
-                    PGM_P searchName = reinterpret_cast<PGM_P>(pgm_read_ptr(&(colorPair->Name)));
-                    size_t str1Size = nameSize;
-                    const char* str1 = name;
-                    const char* str2P = searchName;
+                    nameLength++;
+                }
 
-                    uint16_t result;
+                const HtmlColorPair* colorPair = HtmlColorNamesLookup<T_HTMLCOLORNAMES>::FindName(name, nameLength);
 
-                    while (str1Size > 0)
-                    {
-                        char ch1 = tolower(*str1++);
-                        char ch2 = tolower(pgm_read_byte(str2P++));
-                        result = ch1 - ch2;
-                        if (result != 0 || ch2 == '\0')
-                        {
-                            if (ch2 == '\0' && !isalnum(ch1))
-                            {
-                                // the string continues but is not part of a
-                                // valid color name, 
-                                // ends in white space, deliminator, etc
-                                result = 0;
-                            }
-                            break;
-                        }
-                        result = -1; // have not reached the end of searchName;
-                        str1Size--;
-                    }
-
-                    if (result == 0)
-                    {
-                        Color = pgm_read_dword(&colorPair->Color);
-                        return nameSize - str1Size;
-                    }
+                if (colorPair != nullptr)
+                {
+                    Color = pgm_read_dword(&colorPair->Color);
+                    return nameLength;
                 }
             }
         }
@@ -275,15 +356,13 @@ struct HtmlColor
     template <typename T_HTMLCOLORNAMES> size_t ToString(char* buf, size_t bufSize) const
     {
         // search for a color value/name pairs first
-        for (uint8_t indexName = 0; indexName < T_HTMLCOLORNAMES::Count(); ++indexName)
+        const HtmlColorPair* colorPair = HtmlColorNamesLookup<T_HTMLCOLORNAMES>::FindColor(Color);
+
+        if (colorPair != nullptr)
         {
-            const HtmlColorPair* colorPair = T_HTMLCOLORNAMES::Pair(indexName);
-            if (pgm_read_dword(&colorPair->Color) == Color)
-            {
-                PGM_P name = (PGM_P)pgm_read_ptr(&colorPair->Name);
-                strncpy_P(buf, name, bufSize);
-                return strlen_P(name);
-            }
+            PGM_P name = (PGM_P)pgm_read_ptr(&colorPair->Name);
+            strncpy_P(buf, name, bufSize);
+            return strlen_P(name);
         }
 
         // no color name pair match, convert using numerical format
@@ -324,6 +403,16 @@ struct HtmlColor
         return RgbColor::BilinearBlend(c00, c01, c10, c11, x, y);
     }
 
+    static HtmlColor BilinearBlend(const HtmlColor& c00,
+        const HtmlColor& c01,
+        const HtmlColor& c10,
+        const HtmlColor& c11,
+        NeoProgress16 x,
+        NeoProgress16 y)
+    {
+        return RgbColor::BilinearBlend(c00, c01, c10, c11, x, y);
+    }
+
     // ------------------------------------------------------------------------
     // Color member (0-0xffffff) where 
     // 0xff0000 is red
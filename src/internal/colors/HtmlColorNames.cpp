@@ -28,6 +28,7 @@ License along with NeoPixel.  If not, see
 #include <Arduino.h>
 #include "../NeoUtil.h"
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "HtmlColor.h"
@@ -183,6 +184,52 @@ static const HtmlColorPair c_ColorNames[] PROGMEM = {
     { c_HtmlNameYellowGreen, 0x9acd32 },
 };
 
+// the lookup tables below are checked and regenerated by
+// extras/tools/HtmlColorNamesCheck, run it after changing c_ColorNames
+//
+// indexes into c_ColorNames sorted by name length and then by name,
+// with c_ColorNamesLengthStarts holding the first entry for each length
+static const uint8_t c_ColorNamesByLength[] PROGMEM = {
+    119, 136, 2, 9, 20, 51, 53, 56, 82, 101, 114, 115, 116, 133, 137, 4,
+    5, 7, 11, 16, 54, 61, 62, 84, 103, 142, 143, 6, 60, 86, 105, 107,
+    118, 123, 127, 128, 139, 141, 145, 19, 32, 42, 43, 48, 58, 85, 102, 129,
+    138, 18, 21, 22, 24, 26, 40, 57, 63, 99, 125, 126, 0, 12, 13, 15,
+    25, 27, 45, 49, 52, 59, 65, 67, 69, 71, 73, 74, 83, 97, 98, 104,
+    106, 109, 113, 120, 121, 130, 131, 132, 135, 140, 3, 10, 14, 30, 31, 33,
+    39, 44, 50, 68, 72, 88, 112, 117, 124, 144, 28, 41, 46, 47, 55, 75,
+    81, 100, 122, 134, 146, 1, 34, 66, 77, 89, 90, 96, 23, 35, 36, 37,
+    38, 64, 76, 108, 110, 111, 8, 17, 29, 78, 79, 80, 91, 92, 94, 95,
+    87, 93, 70,
+};
+
+static const uint8_t c_ColorNamesLengthStarts[MAX_HTML_COLOR_NAME_LEN + 2] PROGMEM = {
+    0, 0, 0, 0, 2, 15, 27, 39, 49, 60, 90, 106,
+    117, 124, 134, 141, 144, 145, 146, 146, 146, 147, 147,
+};
+
+// indexes into c_ColorNames sorted by color and then by index, so the
+// first name of colors with several names is found first
+static const uint8_t c_ColorNamesByColor[] PROGMEM = {
+    7, 101, 21, 88, 9, 25, 54, 137, 22, 41, 38, 93, 82, 134, 2, 20,
+    96, 44, 76, 47, 125, 36, 37, 83, 91, 140, 121, 135, 35, 94, 60, 29,
+    13, 17, 87, 42, 43, 130, 104, 131, 132, 78, 79, 92, 65, 14, 3, 86,
+    118, 103, 53, 56, 129, 77, 10, 32, 28, 122, 34, 72, 90, 39, 109, 31,
+    146, 127, 11, 24, 26, 67, 55, 110, 80, 117, 45, 23, 89, 120, 27, 128,
+    95, 59, 114, 15, 136, 71, 73, 111, 138, 107, 52, 19, 49, 116, 12, 69,
+    63, 33, 141, 108, 68, 62, 0, 57, 4, 124, 142, 5, 144, 97, 50, 123,
+    1, 84, 70, 102, 119, 48, 85, 40, 106, 139, 58, 16, 30, 75, 105, 74,
+    115, 51, 113, 100, 99, 6, 98, 8, 112, 64, 126, 18, 66, 46, 133, 145,
+    81, 61, 143,
+};
+
+static const HtmlColorPairIndex c_ColorNamesIndex = {
+    c_ColorNames,
+    c_ColorNamesByLength,
+    c_ColorNamesLengthStarts,
+    c_ColorNamesByColor,
+    countof(c_ColorNames)
+};
+
 const HtmlColorPair* HtmlColorNames::Pair(uint8_t index)
 {
     return &c_ColorNames[index];
@@ -192,3 +239,13 @@ uint8_t HtmlColorNames::Count()
 {
     return countof(c_ColorNames);
 }
+
+const HtmlColorPair* HtmlColorNames::FindName(const char* name, size_t nameLength)
+{
+    return c_ColorNamesIndex.FindName(name, nameLength);
+}
+
+const HtmlColorPair* HtmlColorNames::FindColor(uint32_t color)
+{
+    return c_ColorNamesIndex.FindColor(color);
+}
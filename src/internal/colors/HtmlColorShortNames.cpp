@@ -28,6 +28,7 @@ License along with NeoPixel.  If not, see
 #include <Arduino.h>
 #include "../NeoUtil.h"
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "HtmlColor.h"
@@ -53,6 +54,36 @@ static const HtmlColorPair c_ShortColorNames[] PROGMEM = {
     { c_HtmlNameYellow, 0xffff00 },
 };
 
+// the lookup tables below are checked and regenerated by
+// extras/tools/HtmlColorNamesCheck, run it after changing c_ShortColorNames
+//
+// indexes into c_ShortColorNames sorted by name length and then by name,
+// with c_ShortColorNamesLengthStarts holding the first entry for each length
+static const uint8_t c_ShortColorNamesByLength[] PROGMEM = {
+    12, 0, 2, 4, 6, 8, 14, 1, 5, 9, 15, 7, 10, 11, 13, 16,
+    3,
+};
+
+static const uint8_t c_ShortColorNamesLengthStarts[MAX_HTML_COLOR_NAME_LEN + 2] PROGMEM = {
+    0, 0, 0, 0, 1, 7, 11, 16, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+};
+
+// indexes into c_ShortColorNames sorted by color and then by index, so the
+// first name of colors with several names is found first
+static const uint8_t c_ShortColorNamesByColor[] PROGMEM = {
+    1, 8, 2, 5, 14, 6, 0, 7, 11, 9, 4, 13, 12, 3, 10, 16,
+    15,
+};
+
+static const HtmlColorPairIndex c_ShortColorNamesIndex = {
+    c_ShortColorNames,
+    c_ShortColorNamesByLength,
+    c_ShortColorNamesLengthStarts,
+    c_ShortColorNamesByColor,
+    countof(c_ShortColorNames)
+};
+
 
 const HtmlColorPair* HtmlShortColorNames::Pair(uint8_t index)
 {
@@ -62,4 +93,14 @@ const HtmlColorPair* HtmlShortColorNames::Pair(uint8_t index)
 uint8_t HtmlShortColorNames::Count()
 {
     return countof(c_ShortColorNames);
-}
\ No newline at end of file
+}
+
+const HtmlColorPair* HtmlShortColorNames::FindName(const char* name, size_t nameLength)
+{
+    return c_ShortColorNamesIndex.FindName(name, nameLength);
+}
+
+const HtmlColorPair* HtmlShortColorNames::FindColor(uint32_t color)
+{
+    return c_ShortColorNamesIndex.FindColor(color);
+}
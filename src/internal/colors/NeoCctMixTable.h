@@ -0,0 +1,292 @@
+/*-------------------------------------------------------------------------
+NeoCctMixTable provides a precomputed table that mixes the white and RGB
+elements of a fixture to produce a color temperature
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// NeoCctMixTable is configured once for a fixture with the color temperature
+// (Kelvin) of each of its white elements and how much RGB to mix in, it then
+// converts a color temperature and brightness to a color object with only
+// integer math, a table lookup and interpolation.
+// 
+// The whites are mixed by mired (1000000 / Kelvin) between the two whites
+// that surround the color temperature, keeping the total white constant.
+// The RGB assist (0-255) adds that much of the color temperature as RGB
+// to the whites. Color temperatures warmer or cooler than all the whites can
+// only be reached by RGB, so the whites fade out and the RGB fades in
+// toward kelvinMin or kelvinMax.
+// The table is normalized as a whole so its largest element is at full
+// brightness.
+//
+// T_COLOR_OBJECT - a color object with white elements, one of
+//      RgbwColor, Rgbw64Color, RgbwwColor, Rgbww80Color, RgbwwwColor
+// V_ENTRIES - the number of table entries spread evenly from kelvinMin
+//      to kelvinMax, each uses 2 bytes per element
+//
+// examples:
+//  const uint16_t whites[] = { 2700, 6500 }; // WW, CW
+//  NeoCctMixTable<RgbwwColor> cct(whites, 32);
+//  strip.ClearTo(cct.Mix(4000, 128));
+//
+template<typename T_COLOR_OBJECT, uint8_t V_ENTRIES = 32> class NeoCctMixTable
+{
+public:
+    static_assert(T_COLOR_OBJECT::Count > 3, "T_COLOR_OBJECT must have white elements");
+    static_assert(V_ENTRIES >= 2, "V_ENTRIES must be at least 2");
+
+    static const uint8_t WhiteCount = T_COLOR_OBJECT::Count - 3;
+
+    // whiteKelvins - the color temperature of each white element, in the
+    //      same order as the color object (W, or WW and CW, or W1, W2, and W3)
+    // rgbAssist - how much of the color temperature is added as RGB (0-255)
+    // kelvinMin, kelvinMax - the range of the table, a kelvinMax that is not
+    //      greater than kelvinMin is rejected and kelvinMin + 1 used instead
+    NeoCctMixTable(const uint16_t* whiteKelvins,
+        uint8_t rgbAssist = 0,
+        uint16_t kelvinMin = 1000,
+        uint16_t kelvinMax = 10000) :
+        _kelvinMin((kelvinMin < 0xffff) ? kelvinMin : 0xfffe),
+        _kelvinMax((kelvinMax > _kelvinMin) ? kelvinMax : _kelvinMin + 1),
+        _scale((static_cast<uint32_t>(V_ENTRIES - 1) << 16) / (_kelvinMax - _kelvinMin))
+    {
+        buildTable(whiteKelvins, rgbAssist);
+    }
+
+    uint16_t KelvinMin() const
+    {
+        return _kelvinMin;
+    }
+
+    uint16_t KelvinMax() const
+    {
+        return _kelvinMax;
+    }
+
+    // kelvin - the color temperature, clamped to the range of the table
+    // brightness - 0 to T_COLOR_OBJECT::Max
+    T_COLOR_OBJECT Mix(uint16_t kelvin, uint16_t brightness = T_COLOR_OBJECT::Max) const
+    {
+        uint8_t index = V_ENTRIES - 1;
+        uint16_t fraction = 0;
+
+        if (kelvin <= _kelvinMin)
+        {
+            index = 0;
+        }
+        else if (kelvin < _kelvinMax)
+        {
+            uint32_t position = static_cast<uint32_t>(kelvin - _kelvinMin) * _scale;
+
+            index = position >> 16;
+            fraction = (position >> 8) & 0xff;
+        }
+
+        const uint16_t* pLow = &_table[index * T_COLOR_OBJECT::Count];
+        const uint16_t* pHigh = (index < V_ENTRIES - 1) ? pLow + T_COLOR_OBJECT::Count : pLow;
+        uint32_t scale = static_cast<uint32_t>(brightness) + 1;
+        T_COLOR_OBJECT result;
+
+        for (size_t element = 0; element < T_COLOR_OBJECT::Count; element++)
+        {
+            int32_t delta = static_cast<int32_t>(pHigh[element]) - pLow[element];
+            uint32_t value = pLow[element] + delta * fraction / 256;
+
+            result[element] = (value * scale) >> 16;
+        }
+        return result;
+    }
+
+private:
+    const uint16_t _kelvinMin;
+    const uint16_t _kelvinMax;
+    const uint32_t _scale; // table entries per Kelvin, 16.16 fixed point
+    uint16_t _table[V_ENTRIES * T_COLOR_OBJECT::Count];
+
+    void buildTable(const uint16_t* whiteKelvins, uint8_t rgbAssist)
+    {
+        // whites ordered from warmest to coolest
+        uint8_t order[WhiteCount];
+
+        for (uint8_t white = 0; white < WhiteCount; white++)
+        {
+            uint8_t insert = white;
+
+            while (insert > 0 && whiteKelvins[order[insert - 1]] > whiteKelvins[white])
+            {
+                order[insert] = order[insert - 1];
+                insert--;
+            }
+            order[insert] = white;
+        }
+
+        // the whole table shares one normalization so the total white
+        // stays constant across the color temperatures
+        float largest = 0.0f;
+
+        for (uint8_t entry = 0; entry < V_ENTRIES; entry++)
+        {
+            float elements[T_COLOR_OBJECT::Count];
+
+            calcEntry(entry, order, whiteKelvins, rgbAssist, elements);
+            for (size_t element = 0; element < T_COLOR_OBJECT::Count; element++)
+            {
+                if (elements[element] > largest)
+                {
+                    largest = elements[element];
+                }
+            }
+        }
+
+        for (uint8_t entry = 0; entry < V_ENTRIES; entry++)
+        {
+            float elements[T_COLOR_OBJECT::Count];
+            uint16_t* pEntry = &_table[entry * T_COLOR_OBJECT::Count];
+
+            calcEntry(entry, order, whiteKelvins, rgbAssist, elements);
+            for (size_t element = 0; element < T_COLOR_OBJECT::Count; element++)
+            {
+                pEntry[element] = (largest > 0.0f) ? 
+                    static_cast<uint16_t>(65535.0f * elements[element] / largest + 0.5f) : 
+                    0;
+            }
+        }
+    }
+
+    // calculates the unnormalized elements of a table entry
+    void calcEntry(uint8_t entry, 
+        const uint8_t* order, 
+        const uint16_t* whiteKelvins, 
+        uint8_t rgbAssist,
+        float* elements) const
+    {
+        float miredMin = 1000000.0f / _kelvinMax;
+        float miredMax = 1000000.0f / _kelvinMin;
+        float miredWarm = 1000000.0f / whiteKelvins[order[0]];
+        float miredCool = 1000000.0f / whiteKelvins[order[WhiteCount - 1]];
+
+        float kelvin = _kelvinMin + static_cast<float>(_kelvinMax - _kelvinMin) * entry / (V_ENTRIES - 1);
+        float mired = 1000000.0f / kelvin;
+        float whiteLevel = 1.0f;
+
+        for (size_t element = 0; element < T_COLOR_OBJECT::Count; element++)
+        {
+            elements[element] = 0.0f;
+        }
+
+        if (mired >= miredWarm)
+        {
+            elements[3 + order[0]] = 1.0f;
+            if (mired > miredWarm)
+            {
+                whiteLevel = (miredMax - mired) / (miredMax - miredWarm);
+            }
+        }
+        else if (mired <= miredCool)
+        {
+            elements[3 + order[WhiteCount - 1]] = 1.0f;
+            if (mired < miredCool)
+            {
+                whiteLevel = (mired - miredMin) / (miredCool - miredMin);
+            }
+        }
+        else
+        {
+            // between two whites
+            uint8_t warmer = 0;
+
+            while (1000000.0f / whiteKelvins[order[warmer + 1]] > mired)
+            {
+                warmer++;
+            }
+
+            float miredWarmer = 1000000.0f / whiteKelvins[order[warmer]];
+            float miredCooler = 1000000.0f / whiteKelvins[order[warmer + 1]];
+            float progress = (miredWarmer - mired) / (miredWarmer - miredCooler);
+
+            elements[3 + order[warmer]] = 1.0f - progress;
+            elements[3 + order[warmer + 1]] = progress;
+        }
+
+        whiteLevel = constrain(whiteLevel, 0.0f, 1.0f);
+
+        float assist = rgbAssist / 255.0f;
+        float rgbLevel = assist + (1.0f - assist) * (1.0f - whiteLevel);
+
+        kelvinToRgb(kelvin, elements);
+
+        for (size_t element = 0; element < T_COLOR_OBJECT::Count; element++)
+        {
+            elements[element] *= (element < 3) ? rgbLevel : whiteLevel;
+        }
+    }
+
+    // approximation of the black body color, normalized so the 
+    // largest of R, G, B is 1.0
+    static void kelvinToRgb(float kelvin, float* rgb)
+    {
+        float temperature = kelvin / 100.0f;
+
+        if (temperature <= 66.0f)
+        {
+            rgb[0] = 255.0f;
+            rgb[1] = 99.4708025861f * log(temperature) - 161.1195681661f;
+        }
+        else
+        {
+            rgb[0] = 329.698727446f * pow(temperature - 60.0f, -0.1332047592f);
+            rgb[1] = 288.1221695283f * pow(temperature - 60.0f, -0.0755148492f);
+        }
+
+        if (temperature >= 66.0f)
+        {
+            rgb[2] = 255.0f;
+        }
+        else if (temperature <= 19.0f)
+        {
+            rgb[2] = 0.0f;
+        }
+        else
+        {
+            rgb[2] = 138.5177312231f * log(temperature - 10.0f) - 305.0447927307f;
+        }
+
+        float largest = 0.0f;
+
+        for (uint8_t element = 0; element < 3; element++)
+        {
+            rgb[element] = constrain(rgb[element], 0.0f, 255.0f);
+            if (rgb[element] > largest)
+            {
+                largest = rgb[element];
+            }
+        }
+
+        for (uint8_t element = 0; element < 3; element++)
+        {
+            rgb[element] /= largest;
+        }
+    }
+};
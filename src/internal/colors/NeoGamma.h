@@ -31,6 +31,8 @@ License along with NeoPixel.  If not, see
 //    NeoGammaEquationMethod 
 //    NeoGammaCieLabEquationMethod
 //    NeoGammaTableMethod
+//    NeoGammaCurveTableMethod<curve>
+//    NeoGammaSegmentTableMethod<curve>
 //    NeoGammaNullMethod
 //    NeoGammaInvert<one of the above>
 //
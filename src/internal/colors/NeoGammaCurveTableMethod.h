@@ -0,0 +1,80 @@
+/*-------------------------------------------------------------------------
+NeoGammaCurveTableMethod class is used to correct RGB colors for human eye gamma levels
+using tables built by the compiler from a gamma curve
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+template<typename T_CURVE, typename T_SEQUENCE> struct NeoGammaCurveTable8;
+
+template<typename T_CURVE, uint16_t... V_INDEX> 
+struct NeoGammaCurveTable8<T_CURVE, NeoGammaIndexSequence<V_INDEX...>>
+{
+    static constexpr uint8_t Value(uint16_t index)
+    {
+        return static_cast<uint8_t>(255.0 * T_CURVE::Apply(index / 255.0) + 0.5);
+    }
+
+    static const uint8_t Table[sizeof...(V_INDEX)];
+};
+
+template<typename T_CURVE, uint16_t... V_INDEX>
+const uint8_t NeoGammaCurveTable8<T_CURVE, NeoGammaIndexSequence<V_INDEX...>>::Table[sizeof...(V_INDEX)] PROGMEM = 
+{ 
+    Value(V_INDEX)... 
+};
+
+// NeoGammaCurveTableMethod uses tables that the compiler builds from the
+// curve into PROGMEM, so there is no RAM used and no runtime initialization.
+// The 8 bit table uses 256 bytes and the 16 bit table uses 514 bytes, 
+// each is only included when that Correct is used.
+// 16 bit values use NeoGammaSegmentTableMethod with 256 segments.
+// T_CURVE - 
+//    NeoGammaPowerCurve<>
+//    NeoGammaCieLabCurve
+//    NeoGammaSrgbCurve
+//    or any class with a constexpr static double Apply(double unitValue)
+//
+template<typename T_CURVE> class NeoGammaCurveTableMethod
+{
+public:
+    static uint8_t Correct(uint8_t value)
+    {
+        return pgm_read_byte(&Table8::Table[value]);
+    }
+
+    static uint16_t Correct(uint16_t value)
+    {
+        return NeoGammaSegmentTableMethod<T_CURVE, 256>::Correct(value);
+    }
+
+private:
+    typedef NeoGammaCurveTable8<T_CURVE, 
+        typename NeoGammaMakeIndexSequence<256>::Type> Table8;
+
+    // the table values must be computed by the compiler, as they are 
+    // stored in PROGMEM, this fails to compile if the curve is not constexpr
+    static_assert(Table8::Value(255) == 255, "T_CURVE must map 1.0 to 1.0 and be constexpr");
+};
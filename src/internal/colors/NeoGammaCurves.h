@@ -0,0 +1,158 @@
+/*-------------------------------------------------------------------------
+NeoGammaCurves provides gamma curves that can be evaluated by the compiler
+to build gamma tables at compile time
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// constexpr math used by the curves so they can be evaluated by the compiler,
+// written as single return statements so they are valid C++11 constexpr
+// functions; these are too slow to be used at runtime
+class NeoGammaCurveMath
+{
+public:
+    static constexpr double Pow(double base, double exponent)
+    {
+        return (base <= 0.0) ? 0.0 : Exp(exponent * Ln(base));
+    }
+
+    static constexpr double Exp(double value)
+    {
+        // halve large values so the series converges quickly, 
+        // then square the result back
+        return (value < -0.5 || value > 0.5) ?
+            square(Exp(value * 0.5)) :
+            expSeries(value, 1.0, 1.0, 1);
+    }
+
+    static constexpr double Ln(double value)
+    {
+        // scale into 0.5 to 1.0 by powers of two, 
+        // then use the atanh series that converges quickly in that range
+        return (value < 0.5) ? Ln(value * 2.0) - Ln2 :
+            (value > 1.0) ? Ln(value * 0.5) + Ln2 :
+            2.0 * lnSeries((value - 1.0) / (value + 1.0), 
+                ((value - 1.0) / (value + 1.0)) * ((value - 1.0) / (value + 1.0)), 
+                0);
+    }
+
+private:
+    static constexpr double Ln2 = 0.69314718055994530942;
+
+    static constexpr double square(double value)
+    {
+        return value * value;
+    }
+
+    static constexpr double expSeries(double value, double term, double sum, int n)
+    {
+        return (n > 16) ? sum : 
+            expSeries(value, term * value / n, sum + term * value / n, n + 1);
+    }
+
+    static constexpr double lnSeries(double power, double powerStep, int n)
+    {
+        return (n > 20) ? 0.0 : 
+            power / (2 * n + 1) + lnSeries(power * powerStep, powerStep, n + 1);
+    }
+};
+
+// Each curve provides Apply that converts a unit value (0.0 - 1.0) from
+// perceived brightness to the linear brightness of the LED
+
+// the power curve, the exponent is V_NUMERATOR / V_DENOMINATOR
+// NeoGammaPowerCurve<260> is a gamma of 2.6
+// NeoGammaPowerCurve<100, 45> matches NeoGammaEquationMethod
+template<uint16_t V_NUMERATOR, uint16_t V_DENOMINATOR = 100> class NeoGammaPowerCurve
+{
+public:
+    static constexpr double Apply(double unitValue)
+    {
+        return NeoGammaCurveMath::Pow(unitValue, 
+            static_cast<double>(V_NUMERATOR) / V_DENOMINATOR);
+    }
+};
+
+// the CIE L* curve, matches NeoGammaCieLabEquationMethod
+class NeoGammaCieLabCurve
+{
+public:
+    static constexpr double Apply(double unitValue)
+    {
+        return (unitValue <= 0.08) ? 
+            unitValue / 9.033 :
+            cube((unitValue + 0.16) / 1.16);
+    }
+
+private:
+    static constexpr double cube(double value)
+    {
+        return value * value * value;
+    }
+};
+
+// the sRGB transfer curve
+class NeoGammaSrgbCurve
+{
+public:
+    static constexpr double Apply(double unitValue)
+    {
+        return (unitValue <= 0.04045) ?
+            unitValue / 12.92 :
+            NeoGammaCurveMath::Pow((unitValue + 0.055) / 1.055, 2.4);
+    }
+};
+
+// C++11 does not provide std::integer_sequence, this is the minimal 
+// equivalent used to expand the table initializers
+template<uint16_t... V_INDEX> struct NeoGammaIndexSequence
+{
+};
+
+template<typename T_FIRST, typename T_SECOND> struct NeoGammaIndexConcat;
+
+template<uint16_t... V_FIRST, uint16_t... V_SECOND> 
+struct NeoGammaIndexConcat<NeoGammaIndexSequence<V_FIRST...>, NeoGammaIndexSequence<V_SECOND...>>
+{
+    typedef NeoGammaIndexSequence<V_FIRST..., (sizeof...(V_FIRST) + V_SECOND)...> Type;
+};
+
+// builds 0 to V_COUNT - 1 by halves so the template depth stays small
+template<uint16_t V_COUNT> struct NeoGammaMakeIndexSequence
+{
+    typedef typename NeoGammaIndexConcat<
+        typename NeoGammaMakeIndexSequence<V_COUNT / 2>::Type,
+        typename NeoGammaMakeIndexSequence<V_COUNT - V_COUNT / 2>::Type>::Type Type;
+};
+
+template<> struct NeoGammaMakeIndexSequence<1>
+{
+    typedef NeoGammaIndexSequence<0> Type;
+};
+
+template<> struct NeoGammaMakeIndexSequence<0>
+{
+    typedef NeoGammaIndexSequence<> Type;
+};
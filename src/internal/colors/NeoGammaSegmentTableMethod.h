@@ -0,0 +1,116 @@
+/*-------------------------------------------------------------------------
+NeoGammaSegmentTableMethod class is used to correct RGB colors for human eye gamma levels
+using piecewise linear segments of a gamma curve
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// the segment table has V_SEGMENTS + 1 points evenly spaced across the
+// range, including both ends
+template<typename T_CURVE, uint16_t V_SEGMENTS, typename T_SEQUENCE> struct NeoGammaSegmentTable;
+
+template<typename T_CURVE, uint16_t V_SEGMENTS, uint16_t... V_INDEX>
+struct NeoGammaSegmentTable<T_CURVE, V_SEGMENTS, NeoGammaIndexSequence<V_INDEX...>>
+{
+    static constexpr uint16_t Value(uint16_t index)
+    {
+        return static_cast<uint16_t>(65535.0 * T_CURVE::Apply(static_cast<double>(index) / V_SEGMENTS) + 0.5);
+    }
+
+    static const uint16_t Table[sizeof...(V_INDEX)];
+};
+
+template<typename T_CURVE, uint16_t V_SEGMENTS, uint16_t... V_INDEX>
+const uint16_t NeoGammaSegmentTable<T_CURVE, V_SEGMENTS, NeoGammaIndexSequence<V_INDEX...>>::Table[sizeof...(V_INDEX)] PROGMEM =
+{
+    Value(V_INDEX)...
+};
+
+// NeoGammaSegmentTableMethod uses a small table of linear segments that 
+// the compiler builds from the curve into PROGMEM, the correction is integer
+// only with a single multiply and shift.
+// The table uses (V_SEGMENTS + 1) * 2 bytes and serves both 8 and 16 bit values.
+// 
+// The max 16 bit error measured against the exact equation of the
+// provided curves (power 2.6 and 1/0.45, CIE Lab, sRGB), 
+//      V_SEGMENTS  table   max error   max error below 8192
+//      64          130     9.5         3.6
+//      128         258     3.2         1.6
+//      256         514     1.9         1.2
+// the 8 bit results are within 1 of the exact equation for all of them.
+// Most of the error is at the bright end where the curves bend the most.
+// extras/tools/NeoGammaSegmentTableCheck measures these on the host.
+//
+// T_CURVE - 
+//    NeoGammaPowerCurve<>
+//    NeoGammaCieLabCurve
+//    NeoGammaSrgbCurve
+//    or any class with a constexpr static double Apply(double unitValue)
+// V_SEGMENTS - 64, 128, or 256
+//
+template<typename T_CURVE, uint16_t V_SEGMENTS = 128> class NeoGammaSegmentTableMethod
+{
+public:
+    static_assert(V_SEGMENTS == 64 || V_SEGMENTS == 128 || V_SEGMENTS == 256, 
+        "V_SEGMENTS must be 64, 128, or 256");
+
+    static uint8_t Correct(uint8_t value)
+    {
+        // 8 bit values are spread to 16 bits with the same ratio
+        uint32_t result = Correct(static_cast<uint16_t>(value * 257));
+
+        return (result + 128) / 257;
+    }
+
+    static uint16_t Correct(uint16_t value)
+    {
+        // scale 0-65535 to 0-65536 so the last point is reached
+        uint32_t position = value + (value >> 15);
+        uint16_t index = position >> SegmentShift;
+        uint16_t fraction = position & (SegmentLength - 1);
+        uint16_t low = pgm_read_word(&Table::Table[index]);
+
+        if (fraction == 0)
+        {
+            return low;
+        }
+
+        uint16_t high = pgm_read_word(&Table::Table[index + 1]);
+
+        return low + ((static_cast<uint32_t>(high - low) * fraction + SegmentLength / 2) >> SegmentShift);
+    }
+
+private:
+    static const uint8_t SegmentShift = (V_SEGMENTS == 64) ? 10 : ((V_SEGMENTS == 128) ? 9 : 8);
+    static const uint16_t SegmentLength = 1 << SegmentShift;
+
+    typedef NeoGammaSegmentTable<T_CURVE,
+        V_SEGMENTS,
+        typename NeoGammaMakeIndexSequence<V_SEGMENTS + 1>::Type> Table;
+
+    // the table values must be computed by the compiler, as they are 
+    // stored in PROGMEM, this fails to compile if the curve is not constexpr
+    static_assert(Table::Value(V_SEGMENTS) == 65535, "T_CURVE must map 1.0 to 1.0 and be constexpr");
+};
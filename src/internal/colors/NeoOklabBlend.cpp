@@ -0,0 +1,209 @@
+/*-------------------------------------------------------------------------
+NeoOklabBlend provides perceptual blending of colors in the OKLab space
+using fixed point math and small tables
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#include <Arduino.h>
+#include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
+#include "RgbColorBase.h"
+#include "RgbColor.h"
+#include "RgbwColor.h"
+#include "NeoOklabBlend.h"
+
+// sRGB element to linear light, rounded from the sRGB equation
+static const uint16_t c_SrgbToLinear[256] PROGMEM = {
+        0,    20,    40,    60,    80,    99,   119,   139,   159,   179,   199,   219,   241,   264,   288,   313,
+      340,   367,   396,   427,   458,   491,   526,   562,   599,   637,   677,   718,   761,   805,   851,   898,
+      947,   997,  1048,  1101,  1156,  1212,  1270,  1330,  1391,  1453,  1517,  1583,  1651,  1720,  1790,  1863,
+     1937,  2013,  2090,  2170,  2250,  2333,  2418,  2504,  2592,  2681,  2773,  2866,  2961,  3058,  3157,  3258,
+     3360,  3464,  3570,  3678,  3788,  3900,  4014,  4129,  4247,  4366,  4488,  4611,  4736,  4864,  4993,  5124,
+     5257,  5392,  5530,  5669,  5810,  5953,  6099,  6246,  6395,  6547,  6700,  6856,  7014,  7174,  7335,  7500,
+     7666,  7834,  8004,  8177,  8352,  8528,  8708,  8889,  9072,  9258,  9445,  9635,  9828, 10022, 10219, 10417,
+    10619, 10822, 11028, 11235, 11446, 11658, 11873, 12090, 12309, 12530, 12754, 12980, 13209, 13440, 13673, 13909,
+    14146, 14387, 14629, 14874, 15122, 15371, 15623, 15878, 16135, 16394, 16656, 16920, 17187, 17456, 17727, 18001,
+    18277, 18556, 18837, 19121, 19407, 19696, 19987, 20281, 20577, 20876, 21177, 21481, 21787, 22096, 22407, 22721,
+    23038, 23357, 23678, 24002, 24329, 24658, 24990, 25325, 25662, 26001, 26344, 26688, 27036, 27386, 27739, 28094,
+    28452, 28813, 29176, 29542, 29911, 30282, 30656, 31033, 31412, 31794, 32179, 32567, 32957, 33350, 33745, 34143,
+    34544, 34948, 35355, 35764, 36176, 36591, 37008, 37429, 37852, 38278, 38706, 39138, 39572, 40009, 40449, 40891,
+    41337, 41785, 42236, 42690, 43147, 43606, 44069, 44534, 45002, 45473, 45947, 46423, 46903, 47385, 47871, 48359,
+    48850, 49344, 49841, 50341, 50844, 51349, 51858, 52369, 52884, 53401, 53921, 54445, 54971, 55500, 56032, 56567,
+    57105, 57646, 58190, 58737, 59287, 59840, 60396, 60955, 61517, 62082, 62650, 63221, 63795, 64372, 64952, 65535
+};
+
+// cube root of (index * 1024 / 65536) for index 8 to 64 as 0.16 fixed point,
+// inputs are normalized by multiples of 3 bits into this range first
+static const uint16_t c_CubeRoot[57] PROGMEM = {
+    32768, 34080, 35298, 36438, 37510, 38524, 39488, 40406,
+    41285, 42128, 42938, 43719, 44473, 45202, 45909, 46594,
+    47260, 47907, 48538, 49152, 49751, 50337, 50909, 51468,
+    52016, 52552, 53078, 53593, 54099, 54595, 55083, 55562,
+    56032, 56496, 56951, 57400, 57841, 58276, 58705, 59127,
+    59543, 59954, 60359, 60759, 61153, 61543, 61928, 62308,
+    62683, 63054, 63420, 63783, 64141, 64496, 64846, 65193,
+    65535
+};
+
+uint16_t NeoOklabBlend::ToLinear(uint8_t value)
+{
+    return pgm_read_word(&c_SrgbToLinear[value]);
+}
+
+uint8_t NeoOklabBlend::FromLinear(uint16_t linear)
+{
+    // search for the last entry not above linear, then round to the nearer
+    // of it and the next entry
+    uint8_t index = 0;
+
+    for (uint8_t step = 128; step != 0; step >>= 1)
+    {
+        uint8_t probe = index + step;
+
+        if (pgm_read_word(&c_SrgbToLinear[probe]) <= linear)
+        {
+            index = probe;
+        }
+    }
+
+    if (index < 255)
+    {
+        uint16_t below = linear - pgm_read_word(&c_SrgbToLinear[index]);
+        uint16_t above = pgm_read_word(&c_SrgbToLinear[index + 1]) - linear;
+
+        if (above < below)
+        {
+            index++;
+        }
+    }
+    return index;
+}
+
+uint16_t NeoOklabBlend::cubeRoot(uint16_t value)
+{
+    if (value == 0)
+    {
+        return 0;
+    }
+
+    // cube root(value * 8^n) = cube root(value) * 2^n
+    uint32_t normal = value;
+    uint8_t shift = 0;
+
+    while (normal < 8192)
+    {
+        normal <<= 3;
+        shift++;
+    }
+
+    uint8_t index = (normal >> 10) - 8;
+    uint32_t fraction = normal & 0x3ff;
+    uint32_t low = pgm_read_word(&c_CubeRoot[index]);
+    uint32_t high = pgm_read_word(&c_CubeRoot[index + 1]);
+    uint32_t result = low + (((high - low) * fraction + 0x200) >> 10);
+
+    return (result + ((1 << shift) >> 1)) >> shift;
+}
+
+uint16_t NeoOklabBlend::cube(uint16_t value)
+{
+    uint32_t square = (static_cast<uint32_t>(value) * value + 0x8000) >> 16;
+
+    return (square * value + 0x8000) >> 16;
+}
+
+NeoOklabBlend::Lms NeoOklabBlend::toLms(const RgbColor& color)
+{
+    // linear sRGB to LMS with 2.14 fixed point coefficients, rows sum to 1.0
+    uint32_t r = ToLinear(color.R);
+    uint32_t g = ToLinear(color.G);
+    uint32_t b = ToLinear(color.B);
+    Lms lms;
+
+    lms.L = cubeRoot((r * 6754 + g * 8787 + b * 843 + 0x2000) >> 14);
+    lms.M = cubeRoot((r * 3472 + g * 11152 + b * 1760 + 0x2000) >> 14);
+    lms.S = cubeRoot((r * 1447 + g * 4616 + b * 10321 + 0x2000) >> 14);
+    return lms;
+}
+
+RgbColor NeoOklabBlend::fromLms(const Lms& lms)
+{
+    // LMS to linear sRGB with 4.12 fixed point coefficients, rows sum to 1.0
+    int32_t l = cube(lms.L);
+    int32_t m = cube(lms.M);
+    int32_t s = cube(lms.S);
+    int32_t linear[3] = {
+        l * 16698 - m * 13548 + s * 946,
+        l * -5196 + m * 10690 - s * 1398,
+        l * -17 - m * 2881 + s * 6994 };
+    RgbColor result;
+
+    for (uint8_t elem = 0; elem < 3; elem++)
+    {
+        int32_t value = (linear[elem] + 0x800) / 0x1000;
+
+        // out of gamut blends are clipped
+        if (value < 0)
+        {
+            value = 0;
+        }
+        else if (value > 65535)
+        {
+            value = 65535;
+        }
+        result[elem] = FromLinear(value);
+    }
+    return result;
+}
+
+RgbColor NeoOklabBlend::LinearBlend(const RgbColor& left, const RgbColor& right, NeoProgress16 progress)
+{
+    if (progress.Value == 0 || left == right)
+    {
+        return left;
+    }
+    if (progress.Value == NeoProgress16::Max)
+    {
+        return right;
+    }
+
+    Lms lmsLeft = toLms(left);
+    Lms lmsRight = toLms(right);
+    Lms lms;
+
+    lms.L = progress.Lerp(lmsLeft.L, lmsRight.L);
+    lms.M = progress.Lerp(lmsLeft.M, lmsRight.M);
+    lms.S = progress.Lerp(lmsLeft.S, lmsRight.S);
+
+    return fromLms(lms);
+}
+
+RgbwColor NeoOklabBlend::LinearBlend(const RgbwColor& left, const RgbwColor& right, NeoProgress16 progress)
+{
+    RgbwColor result(LinearBlend(RgbColor(left.R, left.G, left.B),
+        RgbColor(right.R, right.G, right.B),
+        progress));
+
+    result.W = FromLinear(progress.Lerp(ToLinear(left.W), ToLinear(right.W)));
+    return result;
+}
@@ -0,0 +1,98 @@
+/*-------------------------------------------------------------------------
+NeoOklabBlend provides perceptual blending of colors in the OKLab space
+using fixed point math and small tables
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// NeoOklabBlend blends colors in the OKLab perceptual space, so a blend 
+// between two colors keeps a steady lightness and hue path instead of the 
+// muddy or over bright midpoints of blending the gamma encoded bytes.
+// 
+// OKLab is a linear transform of the cube root of the LMS cone response, so
+// blending OKLab is the same as blending the cube root LMS values; the blend 
+// never leaves that space and needs no floating point:
+//     sRGB -> linear light (256 entry table)
+//     linear light -> LMS (fixed point matrix)
+//     LMS -> cube root LMS (57 entry table with interpolation)
+//     blend, then the same steps in reverse, searching the first table to 
+//     return to sRGB
+// The white channel of RgbwColor is blended in linear light.
+//
+class NeoOklabBlend
+{
+public:
+    // ------------------------------------------------------------------------
+    // LinearBlend between two colors by the amount defined by progress variable
+    // left - the color to start the blend at
+    // right - the color to end the blend at
+    // progress - (0.0 - 1.0) value where 0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted perceptually between them
+    // ------------------------------------------------------------------------
+    static RgbColor LinearBlend(const RgbColor& left, const RgbColor& right, float progress)
+    {
+        return LinearBlend(left, right, NeoProgress16::FromFloat(progress));
+    }
+    // progress - (0 - 255) value where 0 will return left and 255 will return right
+    //     and a value between will blend the color weighted perceptually between them
+    // ------------------------------------------------------------------------
+    static RgbColor LinearBlend(const RgbColor& left, const RgbColor& right, uint8_t progress)
+    {
+        return LinearBlend(left, right, NeoProgress16(progress * 257));
+    }
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted perceptually between them
+    // ------------------------------------------------------------------------
+    static RgbColor LinearBlend(const RgbColor& left, const RgbColor& right, NeoProgress16 progress);
+
+    static RgbwColor LinearBlend(const RgbwColor& left, const RgbwColor& right, float progress)
+    {
+        return LinearBlend(left, right, NeoProgress16::FromFloat(progress));
+    }
+    static RgbwColor LinearBlend(const RgbwColor& left, const RgbwColor& right, uint8_t progress)
+    {
+        return LinearBlend(left, right, NeoProgress16(progress * 257));
+    }
+    static RgbwColor LinearBlend(const RgbwColor& left, const RgbwColor& right, NeoProgress16 progress);
+
+    // ------------------------------------------------------------------------
+    // ToLinear and FromLinear convert a gamma encoded sRGB element to and 
+    // from linear light (0 - 65535)
+    // ------------------------------------------------------------------------
+    static uint16_t ToLinear(uint8_t value);
+    static uint8_t FromLinear(uint16_t linear);
+
+private:
+    struct Lms
+    {
+        uint16_t L;
+        uint16_t M;
+        uint16_t S;
+    };
+
+    static Lms toLms(const RgbColor& color);
+    static RgbColor fromLms(const Lms& lms);
+    static uint16_t cubeRoot(uint16_t value);
+    static uint16_t cube(uint16_t value);
+};
@@ -274,6 +274,15 @@ struct Rgb16Color : RgbColorBase
 
         return Rgb16Color(result.R, result.G, result.B);
     };
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static Rgb16Color LinearBlend(const Rgb16Color& left, const Rgb16Color& right, NeoProgress16 progress)
+    {
+        RgbColor result = RgbColor::LinearBlend(left, right, progress);
+
+        return Rgb16Color(result.R, result.G, result.B);
+    };
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -295,6 +304,20 @@ struct Rgb16Color : RgbColorBase
 
         return Rgb16Color(result.R, result.G, result.B);
     };
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static Rgb16Color BilinearBlend(const Rgb16Color& c00,
+        const Rgb16Color& c01,
+        const Rgb16Color& c10,
+        const Rgb16Color& c11,
+        NeoProgress16 x,
+        NeoProgress16 y)
+    {
+        RgbColor result = RgbColor::BilinearBlend(c00, c01, c10, c11, x, y);
+
+        return Rgb16Color(result.R, result.G, result.B);
+    };
 
     uint32_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
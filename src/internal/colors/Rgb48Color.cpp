@@ -26,11 +26,14 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "Rgb48Color.h"
 #include "HslColor.h"
 #include "HsbColor.h"
+#include "Hsl32Color.h"
+#include "Hsb32Color.h"
 #include "HtmlColor.h"
 
 #include "RgbwColor.h"
@@ -69,6 +72,16 @@ Rgb48Color::Rgb48Color(const HsbColor& color)
     B = static_cast<uint16_t>(b * Max);
 }
 
+Rgb48Color::Rgb48Color(const Hsl32Color& color)
+{
+    Hsl32Color::ConvertToRgb(color.H, color.S * 257, color.L * 257, &R, &G, &B);
+}
+
+Rgb48Color::Rgb48Color(const Hsb32Color& color)
+{
+    Hsb32Color::ConvertToRgb(color.H, color.S * 257, color.B * 257, &R, &G, &B);
+}
+
 uint16_t Rgb48Color::CalculateBrightness() const
 {
     return static_cast<uint16_t>((static_cast<uint32_t>(R) + static_cast<uint32_t>(G) + static_cast<uint32_t>(B)) / 3);
@@ -159,6 +172,13 @@ Rgb48Color Rgb48Color::LinearBlend(const Rgb48Color& left, const Rgb48Color& rig
         left.B + (((static_cast<int64_t>(right.B) - left.B) * static_cast<int64_t>(progress) + 1) >> 8));
 }
 
+Rgb48Color Rgb48Color::LinearBlend(const Rgb48Color& left, const Rgb48Color& right, NeoProgress16 progress)
+{
+    return Rgb48Color(progress.Lerp(left.R, right.R),
+        progress.Lerp(left.G, right.G),
+        progress.Lerp(left.B, right.B));
+}
+
 Rgb48Color Rgb48Color::BilinearBlend(const Rgb48Color& c00, 
     const Rgb48Color& c01, 
     const Rgb48Color& c10, 
@@ -175,4 +195,14 @@ Rgb48Color Rgb48Color::BilinearBlend(const Rgb48Color& c00,
         c00.R * v00 + c10.R * v10 + c01.R * v01 + c11.R * v11,
         c00.G * v00 + c10.G * v10 + c01.G * v01 + c11.G * v11,
         c00.B * v00 + c10.B * v10 + c01.B * v01 + c11.B * v11);
+}
+
+Rgb48Color Rgb48Color::BilinearBlend(const Rgb48Color& c00, 
+    const Rgb48Color& c01, 
+    const Rgb48Color& c10, 
+    const Rgb48Color& c11, 
+    NeoProgress16 x, 
+    NeoProgress16 y)
+{
+    return LinearBlend(LinearBlend(c00, c10, x), LinearBlend(c01, c11, x), y);
 }
\ No newline at end of file
@@ -96,6 +96,16 @@ struct Rgb48Color : RgbColorBase
     // ------------------------------------------------------------------------
     Rgb48Color(const HsbColor& color);
 
+    // ------------------------------------------------------------------------
+    // Construct a Rgb48Color using Hsl32Color
+    // ------------------------------------------------------------------------
+    Rgb48Color(const Hsl32Color& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a Rgb48Color using Hsb32Color
+    // ------------------------------------------------------------------------
+    Rgb48Color(const Hsb32Color& color);
+
     // ------------------------------------------------------------------------
     // Construct a Rgb48Color that will have its values set in latter operations
     // CAUTION:  The R,G,B members are not initialized and may not be consistent
@@ -251,6 +261,10 @@ struct Rgb48Color : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static Rgb48Color LinearBlend(const Rgb48Color& left, const Rgb48Color& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static Rgb48Color LinearBlend(const Rgb48Color& left, const Rgb48Color& right, NeoProgress16 progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -267,6 +281,15 @@ struct Rgb48Color : RgbColorBase
         const Rgb48Color& c11, 
         float x, 
         float y);
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static Rgb48Color BilinearBlend(const Rgb48Color& c00, 
+        const Rgb48Color& c01, 
+        const Rgb48Color& c10, 
+        const Rgb48Color& c11, 
+        NeoProgress16 x, 
+        NeoProgress16 y);
 
     uint32_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
@@ -26,12 +26,15 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "Rgb16Color.h"
 #include "Rgb48Color.h"
 #include "HslColor.h"
 #include "HsbColor.h"
+#include "Hsl32Color.h"
+#include "Hsb32Color.h"
 #include "HtmlColor.h"
 
 #include "RgbwColor.h"
@@ -126,6 +129,32 @@ RgbColor::RgbColor(const HsbColor& color)
     B = static_cast<uint8_t>(b * Max);
 }
 
+RgbColor::RgbColor(const Hsl32Color& color)
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    Hsl32Color::ConvertToRgb(color.H, color.S * 257, color.L * 257, &r, &g, &b);
+
+    R = r >> 8;
+    G = g >> 8;
+    B = b >> 8;
+}
+
+RgbColor::RgbColor(const Hsb32Color& color)
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    Hsb32Color::ConvertToRgb(color.H, color.S * 257, color.B * 257, &r, &g, &b);
+
+    R = r >> 8;
+    G = g >> 8;
+    B = b >> 8;
+}
+
 uint8_t RgbColor::CalculateBrightness() const
 {
     return static_cast<uint8_t>((static_cast<uint16_t>(R) + static_cast<uint16_t>(G) + static_cast<uint16_t>(B)) / 3);
@@ -217,6 +246,13 @@ RgbColor RgbColor::LinearBlend(const RgbColor& left, const RgbColor& right, uint
         left.B + (((static_cast<int32_t>(right.B) - left.B) * static_cast<int32_t>(progress) + 1) >> 8));
 }
 
+RgbColor RgbColor::LinearBlend(const RgbColor& left, const RgbColor& right, NeoProgress16 progress)
+{
+    return RgbColor(progress.Lerp(left.R, right.R),
+        progress.Lerp(left.G, right.G),
+        progress.Lerp(left.B, right.B));
+}
+
 RgbColor RgbColor::BilinearBlend(const RgbColor& c00, 
     const RgbColor& c01, 
     const RgbColor& c10, 
@@ -233,4 +269,14 @@ RgbColor RgbColor::BilinearBlend(const RgbColor& c00,
         c00.R * v00 + c10.R * v10 + c01.R * v01 + c11.R * v11,
         c00.G * v00 + c10.G * v10 + c01.G * v01 + c11.G * v11,
         c00.B * v00 + c10.B * v10 + c01.B * v01 + c11.B * v11);
+}
+
+RgbColor RgbColor::BilinearBlend(const RgbColor& c00, 
+    const RgbColor& c01, 
+    const RgbColor& c10, 
+    const RgbColor& c11, 
+    NeoProgress16 x, 
+    NeoProgress16 y)
+{
+    return LinearBlend(LinearBlend(c00, c10, x), LinearBlend(c01, c11, x), y);
 }
\ No newline at end of file
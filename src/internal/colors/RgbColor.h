@@ -109,6 +109,16 @@ struct RgbColor : RgbColorBase
     // ------------------------------------------------------------------------
     RgbColor(const HsbColor& color);
 
+    // ------------------------------------------------------------------------
+    // Construct a RgbColor using Hsl32Color
+    // ------------------------------------------------------------------------
+    RgbColor(const Hsl32Color& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a RgbColor using Hsb32Color
+    // ------------------------------------------------------------------------
+    RgbColor(const Hsb32Color& color);
+
 
     // ------------------------------------------------------------------------
     // Construct a RgbColor that will have its values set in latter operations
@@ -241,6 +251,10 @@ struct RgbColor : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static RgbColor LinearBlend(const RgbColor& left, const RgbColor& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static RgbColor LinearBlend(const RgbColor& left, const RgbColor& right, NeoProgress16 progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -257,6 +271,15 @@ struct RgbColor : RgbColorBase
         const RgbColor& c11, 
         float x, 
         float y);
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static RgbColor BilinearBlend(const RgbColor& c00, 
+        const RgbColor& c01, 
+        const RgbColor& c10, 
+        const RgbColor& c11, 
+        NeoProgress16 x, 
+        NeoProgress16 y);
 
     uint32_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
@@ -27,11 +27,37 @@ License along with NeoPixel.  If not, see
 
 struct HslColor;
 struct HsbColor;
+struct Hsl32Color;
+struct Hsb32Color;
 struct HtmlColor;
 struct Rgb16Color;
 
 struct RgbColorBase
 {
+    // ------------------------------------------------------------------------
+    // _Scale16 will scale a 16 bit value by a 16 bit unit value where 
+    // 0xffff returns the value unchanged, used by integer color math
+    // ------------------------------------------------------------------------
+    inline static uint16_t _Scale16(uint16_t value, uint16_t scale)
+    {
+        return (static_cast<uint32_t>(value) * (static_cast<uint32_t>(scale) + 1)) >> 16;
+    }
+
+    // ------------------------------------------------------------------------
+    // _FromRgb16 will create a color object from 16 bit red, green, and blue
+    // elements, any other elements will be zero
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_OBJECT> static T_COLOR_OBJECT _FromRgb16(uint16_t r, uint16_t g, uint16_t b)
+    {
+        T_COLOR_OBJECT color(0);
+        // 8 bit element colors keep only the most significant byte
+        const uint8_t shift = (T_COLOR_OBJECT::Max > 255) ? 0 : 8;
+
+        color[0] = r >> shift;
+        color[1] = g >> shift;
+        color[2] = b >> shift;
+        return color;
+    }
 
 protected:
     static float _CalcColor(float p, float q, float t);
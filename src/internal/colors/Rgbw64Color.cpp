@@ -26,6 +26,7 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "RgbwColor.h"
@@ -170,6 +171,14 @@ Rgbw64Color Rgbw64Color::LinearBlend(const Rgbw64Color& left, const Rgbw64Color&
         left.W + (((static_cast<int64_t>(right.W) - left.W) * static_cast<int64_t>(progress) + 1) >> 8));
 }
 
+Rgbw64Color Rgbw64Color::LinearBlend(const Rgbw64Color& left, const Rgbw64Color& right, NeoProgress16 progress)
+{
+    return Rgbw64Color(progress.Lerp(left.R, right.R),
+        progress.Lerp(left.G, right.G),
+        progress.Lerp(left.B, right.B),
+        progress.Lerp(left.W, right.W));
+}
+
 Rgbw64Color Rgbw64Color::BilinearBlend(const Rgbw64Color& c00, 
     const Rgbw64Color& c01, 
     const Rgbw64Color& c10, 
@@ -187,4 +196,14 @@ Rgbw64Color Rgbw64Color::BilinearBlend(const Rgbw64Color& c00,
         c00.G * v00 + c10.G * v10 + c01.G * v01 + c11.G * v11,
         c00.B * v00 + c10.B * v10 + c01.B * v01 + c11.B * v11,
         c00.W * v00 + c10.W * v10 + c01.W * v01 + c11.W * v11 );
+}
+
+Rgbw64Color Rgbw64Color::BilinearBlend(const Rgbw64Color& c00, 
+    const Rgbw64Color& c01, 
+    const Rgbw64Color& c10, 
+    const Rgbw64Color& c11, 
+    NeoProgress16 x, 
+    NeoProgress16 y)
+{
+    return LinearBlend(LinearBlend(c00, c10, x), LinearBlend(c01, c11, x), y);
 }
\ No newline at end of file
@@ -282,6 +282,10 @@ struct Rgbw64Color : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static Rgbw64Color LinearBlend(const Rgbw64Color& left, const Rgbw64Color& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static Rgbw64Color LinearBlend(const Rgbw64Color& left, const Rgbw64Color& right, NeoProgress16 progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -298,6 +302,15 @@ struct Rgbw64Color : RgbColorBase
         const Rgbw64Color& c11, 
         float x, 
         float y);
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static Rgbw64Color BilinearBlend(const Rgbw64Color& c00, 
+        const Rgbw64Color& c01, 
+        const Rgbw64Color& c10, 
+        const Rgbw64Color& c11, 
+        NeoProgress16 x, 
+        NeoProgress16 y);
 
     uint16_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
@@ -26,6 +26,7 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "Rgb48Color.h"
@@ -218,6 +219,14 @@ RgbwColor RgbwColor::LinearBlend(const RgbwColor& left, const RgbwColor& right,
         left.W + (((static_cast<int32_t>(right.W) - left.W) * static_cast<int32_t>(progress) + 1) >> 8));
 }
 
+RgbwColor RgbwColor::LinearBlend(const RgbwColor& left, const RgbwColor& right, NeoProgress16 progress)
+{
+    return RgbwColor(progress.Lerp(left.R, right.R),
+        progress.Lerp(left.G, right.G),
+        progress.Lerp(left.B, right.B),
+        progress.Lerp(left.W, right.W));
+}
+
 RgbwColor RgbwColor::BilinearBlend(const RgbwColor& c00, 
     const RgbwColor& c01, 
     const RgbwColor& c10, 
@@ -235,4 +244,14 @@ RgbwColor RgbwColor::BilinearBlend(const RgbwColor& c00,
         c00.G * v00 + c10.G * v10 + c01.G * v01 + c11.G * v11,
         c00.B * v00 + c10.B * v10 + c01.B * v01 + c11.B * v11,
         c00.W * v00 + c10.W * v10 + c01.W * v01 + c11.W * v11 );
+}
+
+RgbwColor RgbwColor::BilinearBlend(const RgbwColor& c00, 
+    const RgbwColor& c01, 
+    const RgbwColor& c10, 
+    const RgbwColor& c11, 
+    NeoProgress16 x, 
+    NeoProgress16 y)
+{
+    return LinearBlend(LinearBlend(c00, c10, x), LinearBlend(c01, c11, x), y);
 }
\ No newline at end of file
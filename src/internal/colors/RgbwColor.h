@@ -259,6 +259,10 @@ struct RgbwColor : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static RgbwColor LinearBlend(const RgbwColor& left, const RgbwColor& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static RgbwColor LinearBlend(const RgbwColor& left, const RgbwColor& right, NeoProgress16 progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -275,6 +279,15 @@ struct RgbwColor : RgbColorBase
         const RgbwColor& c11, 
         float x, 
         float y);
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static RgbwColor BilinearBlend(const RgbwColor& c00, 
+        const RgbwColor& c01, 
+        const RgbwColor& c10, 
+        const RgbwColor& c11, 
+        NeoProgress16 x, 
+        NeoProgress16 y);
 
     uint16_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
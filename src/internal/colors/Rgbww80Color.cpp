@@ -27,6 +27,7 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "RgbwColor.h"
@@ -199,6 +200,15 @@ Rgbww80Color Rgbww80Color::LinearBlend(const Rgbww80Color& left, const Rgbww80Co
         left.CW + (((static_cast<int64_t>(right.CW) - left.CW) * static_cast<int64_t>(progress) + 1) >> 8));
 }
 
+Rgbww80Color Rgbww80Color::LinearBlend(const Rgbww80Color& left, const Rgbww80Color& right, NeoProgress16 progress)
+{
+    return Rgbww80Color(progress.Lerp(left.R, right.R),
+        progress.Lerp(left.G, right.G),
+        progress.Lerp(left.B, right.B),
+        progress.Lerp(left.WW, right.WW),
+        progress.Lerp(left.CW, right.CW));
+}
+
 Rgbww80Color Rgbww80Color::BilinearBlend(const Rgbww80Color& c00, 
     const Rgbww80Color& c01, 
     const Rgbww80Color& c10, 
@@ -217,4 +227,14 @@ Rgbww80Color Rgbww80Color::BilinearBlend(const Rgbww80Color& c00,
         c00.B * v00 + c10.B * v10 + c01.B * v01 + c11.B * v11,
         c00.WW * v00 + c10.WW * v10 + c01.WW * v01 + c11.WW * v11,
         c00.CW * v00 + c10.CW * v10 + c01.CW * v01 + c11.CW * v11);
+}
+
+Rgbww80Color Rgbww80Color::BilinearBlend(const Rgbww80Color& c00, 
+    const Rgbww80Color& c01, 
+    const Rgbww80Color& c10, 
+    const Rgbww80Color& c11, 
+    NeoProgress16 x, 
+    NeoProgress16 y)
+{
+    return LinearBlend(LinearBlend(c00, c10, x), LinearBlend(c01, c11, x), y);
 }
\ No newline at end of file
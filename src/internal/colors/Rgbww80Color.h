@@ -293,6 +293,10 @@ struct Rgbww80Color : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static Rgbww80Color LinearBlend(const Rgbww80Color& left, const Rgbww80Color& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static Rgbww80Color LinearBlend(const Rgbww80Color& left, const Rgbww80Color& right, NeoProgress16 progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -309,6 +313,15 @@ struct Rgbww80Color : RgbColorBase
         const Rgbww80Color& c11, 
         float x, 
         float y);
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static Rgbww80Color BilinearBlend(const Rgbww80Color& c00, 
+        const Rgbww80Color& c01, 
+        const Rgbww80Color& c10, 
+        const Rgbww80Color& c11, 
+        NeoProgress16 x, 
+        NeoProgress16 y);
 
     uint16_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
@@ -26,6 +26,7 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "RgbwColor.h"
@@ -208,6 +209,15 @@ RgbwwColor RgbwwColor::LinearBlend(const RgbwwColor& left, const RgbwwColor& rig
         left.CW + (((static_cast<int32_t>(right.CW) - left.CW) * static_cast<int32_t>(progress) + 1) >> 8));
 }
 
+RgbwwColor RgbwwColor::LinearBlend(const RgbwwColor& left, const RgbwwColor& right, NeoProgress16 progress)
+{
+    return RgbwwColor(progress.Lerp(left.R, right.R),
+        progress.Lerp(left.G, right.G),
+        progress.Lerp(left.B, right.B),
+        progress.Lerp(left.WW, right.WW),
+        progress.Lerp(left.CW, right.CW));
+}
+
 RgbwwColor RgbwwColor::BilinearBlend(const RgbwwColor& c00, 
     const RgbwwColor& c01, 
     const RgbwwColor& c10, 
@@ -226,4 +236,14 @@ RgbwwColor RgbwwColor::BilinearBlend(const RgbwwColor& c00,
         c00.B * v00 + c10.B * v10 + c01.B * v01 + c11.B * v11,
         c00.WW * v00 + c10.WW * v10 + c01.WW * v01 + c11.WW * v11,
         c00.CW * v00 + c10.CW * v10 + c01.CW * v01 + c11.CW * v11);
+}
+
+RgbwwColor RgbwwColor::BilinearBlend(const RgbwwColor& c00, 
+    const RgbwwColor& c01, 
+    const RgbwwColor& c10, 
+    const RgbwwColor& c11, 
+    NeoProgress16 x, 
+    NeoProgress16 y)
+{
+    return LinearBlend(LinearBlend(c00, c10, x), LinearBlend(c01, c11, x), y);
 }
\ No newline at end of file
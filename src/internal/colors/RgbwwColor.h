@@ -254,6 +254,10 @@ struct RgbwwColor : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static RgbwwColor LinearBlend(const RgbwwColor& left, const RgbwwColor& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static RgbwwColor LinearBlend(const RgbwwColor& left, const RgbwwColor& right, NeoProgress16 progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -270,6 +274,15 @@ struct RgbwwColor : RgbColorBase
         const RgbwwColor& c11, 
         float x, 
         float y);
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static RgbwwColor BilinearBlend(const RgbwwColor& c00, 
+        const RgbwwColor& c01, 
+        const RgbwwColor& c10, 
+        const RgbwwColor& c11, 
+        NeoProgress16 x, 
+        NeoProgress16 y);
 
     uint16_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
@@ -26,6 +26,7 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "../NeoSettings.h"
+#include "../animations/NeoProgress16.h"
 #include "RgbColorBase.h"
 #include "RgbColor.h"
 #include "RgbwColor.h"
@@ -231,6 +232,16 @@ RgbwwwColor RgbwwwColor::LinearBlend(const RgbwwwColor& left, const RgbwwwColor&
         left.W3 + (((static_cast<int32_t>(right.W3) - left.W3) * static_cast<int32_t>(progress) + 1) >> 8));
 }
 
+RgbwwwColor RgbwwwColor::LinearBlend(const RgbwwwColor& left, const RgbwwwColor& right, NeoProgress16 progress)
+{
+    return RgbwwwColor(progress.Lerp(left.R, right.R),
+        progress.Lerp(left.G, right.G),
+        progress.Lerp(left.B, right.B),
+        progress.Lerp(left.W1, right.W1),
+        progress.Lerp(left.W2, right.W2),
+        progress.Lerp(left.W3, right.W3));
+}
+
 RgbwwwColor RgbwwwColor::BilinearBlend(const RgbwwwColor& c00, 
     const RgbwwwColor& c01, 
     const RgbwwwColor& c10, 
@@ -250,4 +261,14 @@ RgbwwwColor RgbwwwColor::BilinearBlend(const RgbwwwColor& c00,
         c00.W1 * v00 + c10.W1 * v10 + c01.W1 * v01 + c11.W1 * v11,
         c00.W2 * v00 + c10.W2 * v10 + c01.W2 * v01 + c11.W2 * v11,
         c00.W3 * v00 + c10.W3 * v10 + c01.W3 * v01 + c11.W3 * v11);
+}
+
+RgbwwwColor RgbwwwColor::BilinearBlend(const RgbwwwColor& c00, 
+    const RgbwwwColor& c01, 
+    const RgbwwwColor& c10, 
+    const RgbwwwColor& c11, 
+    NeoProgress16 x, 
+    NeoProgress16 y)
+{
+    return LinearBlend(LinearBlend(c00, c10, x), LinearBlend(c01, c11, x), y);
 }
\ No newline at end of file
@@ -268,6 +268,10 @@ struct RgbwwwColor : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static RgbwwwColor LinearBlend(const RgbwwwColor& left, const RgbwwwColor& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static RgbwwwColor LinearBlend(const RgbwwwColor& left, const RgbwwwColor& right, NeoProgress16 progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -284,6 +288,15 @@ struct RgbwwwColor : RgbColorBase
         const RgbwwwColor& c11, 
         float x, 
         float y);
+    // x - fixed point unit value (0.0 - 1.0) that defines the blend progress in horizontal space
+    // y - fixed point unit value (0.0 - 1.0) that defines the blend progress in vertical space
+    // ------------------------------------------------------------------------
+    static RgbwwwColor BilinearBlend(const RgbwwwColor& c00, 
+        const RgbwwwColor& c01, 
+        const RgbwwwColor& c10, 
+        const RgbwwwColor& c11, 
+        NeoProgress16 x, 
+        NeoProgress16 y);
 
     uint16_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
     {
@@ -25,6 +25,7 @@ License along with NeoPixel.  If not, see
 -------------------------------------------------------------------------*/
 
 #include <Arduino.h>
+#include "../animations/NeoProgress16.h"
 #include "SegmentDigit.h"
 
 //
@@ -58,6 +59,22 @@ const uint8_t SevenSegDigit::DecodeSpecial[] = {
     // ,     -     .     /
     0x80, 0x40, 0x80, 0x40 };
 
+// all of the above merged for ' ' to DEL, where a letter has no segments in
+// its case the other case is used, as SevenSegDigit(letter) does by default
+const uint8_t SevenSegDigit::DecodeAscii[] PROGMEM = {
+    //       !     "     #     $     %     &     '     (     )     *     +     ,     -     .     /
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x80, 0x40,
+    // 0     1     2     3     4     5     6     7     8     9     :     ;     <     =     >     ?
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // @     A     B     C     D     E     F     G     H     I     J     K     L     M     N     O
+    0x00, 0x77, 0x7F, 0x39, 0x5E, 0x79, 0x71, 0x3D, 0x76, 0x30, 0x1E, 0x00, 0x38, 0x00, 0x54, 0x3F,
+    // P     Q     R     S     T     U     V     W     X     Y     Z     [     \     ]     ^     _
+    0x73, 0x67, 0x50, 0x6D, 0x78, 0x3E, 0x00, 0x00, 0x76, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // `     a     b     c     d     e     f     g     h     i     j     k     l     m     n     o
+    0x00, 0x77, 0x7C, 0x58, 0x5E, 0x79, 0x71, 0x3D, 0x74, 0x30, 0x1E, 0x00, 0x38, 0x00, 0x54, 0x5C,
+    // p     q     r     s     t     u     v     w     x     y     z     {     |     }     ~     DEL
+    0x73, 0x67, 0x50, 0x6D, 0x78, 0x1C, 0x00, 0x00, 0x76, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 void SevenSegDigit::init(uint8_t bitmask, uint8_t brightness, uint8_t defaultBrightness)
 {
     for (uint8_t iSegment = 0; iSegment < Count; iSegment++)
@@ -74,7 +91,11 @@ SevenSegDigit::SevenSegDigit(uint8_t bitmask, uint8_t brightness, uint8_t defaul
 
 SevenSegDigit::SevenSegDigit(char letter, uint8_t brightness, uint8_t defaultBrightness, bool maintainCase)
 {
-    if (letter >= '0' && letter <= '9')
+    if (!maintainCase)
+    {
+        init(DecodeChar(letter), brightness, defaultBrightness);
+    }
+    else if (letter >= '0' && letter <= '9')
     {
         init(DecodeNumbers[letter - '0'], brightness, defaultBrightness);
     }
@@ -108,6 +129,19 @@ SevenSegDigit::SevenSegDigit(char letter, uint8_t brightness, uint8_t defaultBri
     }
 };
 
+uint8_t SevenSegDigit::DecodeChar(char letter)
+{
+    // unsigned so chars below the space and above 0x7f, which are negative
+    // where char is signed, both fall outside the table
+    uint8_t index = static_cast<uint8_t>(letter) - ' ';
+
+    if (index >= sizeof(DecodeAscii))
+    {
+        return 0;
+    }
+    return pgm_read_byte(&DecodeAscii[index]);
+}
+
 uint8_t SevenSegDigit::CalculateBrightness() const
 {
     uint16_t sum = 0;
@@ -199,3 +233,13 @@ SevenSegDigit SevenSegDigit::LinearBlend(const SevenSegDigit& left, const SevenS
     return result;
 }
 
+SevenSegDigit SevenSegDigit::LinearBlend(const SevenSegDigit& left, const SevenSegDigit& right, NeoProgress16 progress)
+{
+    SevenSegDigit result;
+
+    for (uint8_t iSegment = 0; iSegment < Count; iSegment++)
+    {
+        result.Segment[iSegment] = progress.Lerp(left.Segment[iSegment], right.Segment[iSegment]);
+    }
+    return result;
+}
\ No newline at end of file
@@ -189,6 +189,10 @@ struct SevenSegDigit
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static SevenSegDigit LinearBlend(const SevenSegDigit& left, const SevenSegDigit& right, uint8_t progress);
+    // progress - (0.0 - 1.0) fixed point value where 0.0 will return left and 1.0 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static SevenSegDigit LinearBlend(const SevenSegDigit& left, const SevenSegDigit& right, NeoProgress16 progress);
 
 
     uint32_t CalcTotalTenthMilliAmpere(const SettingsObject& settings)
@@ -269,7 +273,7 @@ struct SevenSegDigit
                 pIter--; // skip colon
             }
 
-            SevenSegDigit digit(value, brightness, defaultBrightness);
+            SevenSegDigit digit(DecodeChar(value), brightness, defaultBrightness);
             if (decimal)
             {
                 digit.Segment[LedSegment_Decimal] = brightness;
@@ -298,6 +302,12 @@ struct SevenSegDigit
     static const uint8_t DecodeAlphaCaps[26]; // A-Z
     static const uint8_t DecodeAlpha[26]; // a-z
     static const uint8_t DecodeSpecial[4]; // , - . /
+    static const uint8_t DecodeAscii[96]; // ' ' - DEL, in PROGMEM
+
+    // ------------------------------------------------------------------------
+    // DecodeChar returns the segment bitmask for a char, see DecodeAscii
+    // ------------------------------------------------------------------------
+    static uint8_t DecodeChar(char letter);
 
 protected:
     void init(uint8_t bitmask, uint8_t brightness, uint8_t defaultBrightness);
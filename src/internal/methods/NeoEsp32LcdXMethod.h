@@ -57,7 +57,8 @@ public:
     // by using a 3 step cadence, the dma data can't be updated with a single OR operation as
     //    its value resides across a non-uint16_t aligned 3 element type, so it requires two seperate OR
     //    operations to update a single pixel bit, the last element can be skipped as its always 0
-    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
+    // it is also called from the DMA ISR by NeoEspLcdStreamBuffContext so it must be in IRAM
+    static IRAM_ATTR void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
     {
         uint8_t* pDma = dmaBuffer;
         const uint8_t* pValue = data;
@@ -105,7 +106,8 @@ public:
     // by using a 3 step cadence, the dma data can't be updated with a single OR operation as
     //    its value resides across a non-uint32_t aligned 3 element type, so it requires two seperate OR
     //    operations to update a single pixel bit, the last element can be skipped as its always 0
-    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
+    // it is also called from the DMA ISR by NeoEspLcdStreamBuffContext so it must be in IRAM
+    static IRAM_ATTR void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
     {
         uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
         const uint8_t* pValue = data;
@@ -248,6 +250,105 @@ static IRAM_ATTR bool dma_callback(gdma_channel_handle_t dma_chan,
     return true;
 }
 
+//
+// Configures the LCD peripheral and its DMA channel, shared by the LcdContexts
+// 
+// dmaChannel - the address of the variable to place the allocated DMA channel
+// nsBitSendTime - the pixel bit send time
+// dmaBitsPerPixelBit, muxBusDataSize - see NeoEspLcdMuxBusSize8Bit and NeoEspLcdMuxBusSize16Bit
+// callback, userData - the DMA EOF callback and its user data
+// returns false if the rate isn't supported
+//
+static bool NeoEspLcdConstructPeripheral(gdma_channel_handle_t* dmaChannel,
+        uint16_t nsBitSendTime,
+        size_t dmaBitsPerPixelBit,
+        size_t muxBusDataSize,
+        gdma_event_callback_t callback,
+        void* userData)
+{
+    // LCD_CAM isn't enabled by default -- MUST begin with this:
+    periph_module_enable(PERIPH_LCD_CAM_MODULE);
+    periph_module_reset(PERIPH_LCD_CAM_MODULE);
+
+    // Reset LCD bus
+    LCD_CAM.lcd_user.lcd_reset = 1;
+    esp_rom_delay_us(100);
+
+    // calc needed clock scaler values from bit send time
+    //
+    double clkm_div = (double)nsBitSendTime / dmaBitsPerPixelBit / 1000.0 * 240.0; // PLL 240Mhz
+    if (clkm_div > LCD_LL_CLK_FRAC_DIV_N_MAX)
+    {
+        log_e("rate is too low");
+        return false;
+    }
+    else if (clkm_div < 2.0)
+    {
+        log_e("rate is too fast, clkmdiv = %f (%u)",
+            clkm_div,
+            nsBitSendTime);
+        return false;
+    }
+
+    // calc integer and franctional for more precise timing
+    uint8_t clkm_div_Integer = clkm_div;
+    double clkm_Fraction = (clkm_div - clkm_div_Integer);
+    uint8_t divB = 0;
+    uint8_t divA = 0;
+
+    UnitDecimalToFractionClks(&divB, &divA, clkm_Fraction, 0.000001);
+
+    //Serial.print("Clk Div ");
+    //Serial.print(clkm_div);
+    //Serial.print(" = ");
+
+    //Serial.print(clkm_div_Integer);
+    //Serial.print(" ");
+    //Serial.print(divB);
+    //Serial.print("/");
+    //Serial.println(divA);
+
+    // Configure LCD clock
+    LCD_CAM.lcd_clock.clk_en = 1;             // Enable clock
+    LCD_CAM.lcd_clock.lcd_clk_sel = 2;        // PLL240M source
+    LCD_CAM.lcd_clock.lcd_clkm_div_a = divA;  // scale fractional denomenator,
+    LCD_CAM.lcd_clock.lcd_clkm_div_b = divB;  // scale fractional numerator
+    LCD_CAM.lcd_clock.lcd_clkm_div_num = clkm_div_Integer;  // scale integer (240Mhz clock)
+    LCD_CAM.lcd_clock.lcd_ck_out_edge = 0;    // PCLK low in 1st half cycle
+    LCD_CAM.lcd_clock.lcd_ck_idle_edge = 0;   // PCLK low idle
+    LCD_CAM.lcd_clock.lcd_clk_equ_sysclk = 1; // PCLK = CLK (ignore CLKCNT_N)
+
+    // Configure frame format
+    LCD_CAM.lcd_ctrl.lcd_rgb_mode_en = 0;    // i8080 mode (not RGB)
+    LCD_CAM.lcd_rgb_yuv.lcd_conv_bypass = 0; // Disable RGB/YUV converter
+    LCD_CAM.lcd_misc.lcd_next_frame_en = 0;  // Do NOT auto-frame
+    LCD_CAM.lcd_data_dout_mode.val = 0;      // No data delays
+    LCD_CAM.lcd_user.lcd_always_out_en = 1;  // Enable 'always out' mode
+    LCD_CAM.lcd_user.lcd_8bits_order = 0;    // Do not swap bytes
+    LCD_CAM.lcd_user.lcd_bit_order = 0;      // Do not reverse bit order
+    LCD_CAM.lcd_user.lcd_2byte_en = (muxBusDataSize == 2);
+    LCD_CAM.lcd_user.lcd_dummy = 1;          // Dummy phase(s) @ LCD start
+    LCD_CAM.lcd_user.lcd_dummy_cyclelen = 0; // 1 dummy phase
+    LCD_CAM.lcd_user.lcd_cmd = 0;            // No command at LCD start
+    // Dummy phase(s) MUST be enabled for DMA to trigger reliably.
+
+    // Alloc DMA channel & connect it to LCD periph
+    gdma_channel_alloc_config_t dma_chan_config = {
+        .sibling_chan = NULL,
+        .direction = GDMA_CHANNEL_DIRECTION_TX,
+        .flags = {.reserve_sibling = 0}};
+    gdma_new_channel(&dma_chan_config, dmaChannel);
+    gdma_connect(*dmaChannel, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_LCD, 0));
+    gdma_strategy_config_t strategy_config = {.owner_check = false,
+                                                .auto_update_desc = false};
+    gdma_apply_strategy(*dmaChannel, &strategy_config);
+
+    // Enable DMA transfer callback
+    gdma_tx_event_callbacks_t tx_cbs = {.on_trans_eof = callback};
+    gdma_register_tx_event_callbacks(*dmaChannel, &tx_cbs, userData);
+    return true;
+}
+
 //
 // Implementation of a Single Buffered version of a LcdContext
 // Manages the underlying I2S details including the buffer
@@ -365,89 +466,16 @@ public:
 
             // Configure LCD Peripheral
             // 
-            
-            // LCD_CAM isn't enabled by default -- MUST begin with this:
-            periph_module_enable(PERIPH_LCD_CAM_MODULE);
-            periph_module_reset(PERIPH_LCD_CAM_MODULE);
-
-            // Reset LCD bus
-            LCD_CAM.lcd_user.lcd_reset = 1;
-            esp_rom_delay_us(100);
-
-            // calc needed clock scaler values from bit send time
-            //
-            double clkm_div = (double)nsBitSendTime / T_MUXMAP::DmaBitsPerPixelBit / 1000.0 * 240.0; // PLL 240Mhz
-            if (clkm_div > LCD_LL_CLK_FRAC_DIV_N_MAX)
+            if (!NeoEspLcdConstructPeripheral(&_dmaChannel,
+                    nsBitSendTime,
+                    T_MUXMAP::DmaBitsPerPixelBit,
+                    T_MUXMAP::MuxBusDataSize,
+                    dma_callback,
+                    NULL))
             {
-                log_e("rate is too low");
                 Destruct();
                 return false;
             }
-            else if (clkm_div < 2.0)
-            {
-                log_e("rate is too fast, clkmdiv = %f (%u)",
-                    clkm_div,
-                    nsBitSendTime);
-                Destruct();
-                return false;
-            }
-
-            // calc integer and franctional for more precise timing
-            uint8_t clkm_div_Integer = clkm_div;
-            double clkm_Fraction = (clkm_div - clkm_div_Integer);
-            uint8_t divB = 0;
-            uint8_t divA = 0;
-
-            UnitDecimalToFractionClks(&divB, &divA, clkm_Fraction, 0.000001);
-
-            //Serial.print("Clk Div ");
-            //Serial.print(clkm_div);
-            //Serial.print(" = ");
-
-            //Serial.print(clkm_div_Integer);
-            //Serial.print(" ");
-            //Serial.print(divB);
-            //Serial.print("/");
-            //Serial.println(divA);
-
-            // Configure LCD clock
-            LCD_CAM.lcd_clock.clk_en = 1;             // Enable clock
-            LCD_CAM.lcd_clock.lcd_clk_sel = 2;        // PLL240M source
-            LCD_CAM.lcd_clock.lcd_clkm_div_a = divA;  // scale fractional denomenator,
-            LCD_CAM.lcd_clock.lcd_clkm_div_b = divB;  // scale fractional numerator
-            LCD_CAM.lcd_clock.lcd_clkm_div_num = clkm_div_Integer;  // scale integer (240Mhz clock)
-            LCD_CAM.lcd_clock.lcd_ck_out_edge = 0;    // PCLK low in 1st half cycle
-            LCD_CAM.lcd_clock.lcd_ck_idle_edge = 0;   // PCLK low idle
-            LCD_CAM.lcd_clock.lcd_clk_equ_sysclk = 1; // PCLK = CLK (ignore CLKCNT_N)
-
-            // Configure frame format
-            LCD_CAM.lcd_ctrl.lcd_rgb_mode_en = 0;    // i8080 mode (not RGB)
-            LCD_CAM.lcd_rgb_yuv.lcd_conv_bypass = 0; // Disable RGB/YUV converter
-            LCD_CAM.lcd_misc.lcd_next_frame_en = 0;  // Do NOT auto-frame
-            LCD_CAM.lcd_data_dout_mode.val = 0;      // No data delays
-            LCD_CAM.lcd_user.lcd_always_out_en = 1;  // Enable 'always out' mode
-            LCD_CAM.lcd_user.lcd_8bits_order = 0;    // Do not swap bytes
-            LCD_CAM.lcd_user.lcd_bit_order = 0;      // Do not reverse bit order
-            LCD_CAM.lcd_user.lcd_2byte_en = (T_MUXMAP::MuxBusDataSize == 2);
-            LCD_CAM.lcd_user.lcd_dummy = 1;          // Dummy phase(s) @ LCD start
-            LCD_CAM.lcd_user.lcd_dummy_cyclelen = 0; // 1 dummy phase
-            LCD_CAM.lcd_user.lcd_cmd = 0;            // No command at LCD start
-            // Dummy phase(s) MUST be enabled for DMA to trigger reliably.
-
-            // Alloc DMA channel & connect it to LCD periph
-            gdma_channel_alloc_config_t dma_chan_config = {
-                .sibling_chan = NULL,
-                .direction = GDMA_CHANNEL_DIRECTION_TX,
-                .flags = {.reserve_sibling = 0}};
-            gdma_new_channel(&dma_chan_config, &_dmaChannel);
-            gdma_connect(_dmaChannel, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_LCD, 0));
-            gdma_strategy_config_t strategy_config = {.owner_check = false,
-                                                        .auto_update_desc = false};
-            gdma_apply_strategy(_dmaChannel, &strategy_config);
-
-            // Enable DMA transfer callback
-            gdma_tx_event_callbacks_t tx_cbs = {.on_trans_eof = dma_callback};
-            gdma_register_tx_event_callbacks(_dmaChannel, &tx_cbs, NULL);
         }
         return true;
     }
@@ -520,13 +548,288 @@ public:
     }
 };
 
+//
+// Implementation of a Streaming version of a LcdContext
+// Manages the underlying LCD details including the buffers
+// Rather than a back buffer of the whole expanded frame, this uses a small ring
+// of DMA chunks that the EOF ISR encodes just in time from a copy of the pixel data,
+// so the DMA memory is bounded by the chunk size and not by the strip length
+// Note that only one LcdContext can be used at a time as they share the LCD peripheral
+// 
+// T_MUXMAP - NeoEspLcdMuxMap - tracking class for mux state
+// V_CHUNK_BYTES - the count of pixel data bytes per mux bus that are encoded into each chunk
+// V_CHUNK_COUNT - the count of chunks in the ring, the ISR has the send time of 
+//      (V_CHUNK_COUNT - 1) chunks to encode the next one
+//
+template<typename T_MUXMAP, size_t V_CHUNK_BYTES = 32, size_t V_CHUNK_COUNT = 4> 
+class NeoEspLcdStreamBuffContext 
+{
+private:
+    static_assert(V_CHUNK_COUNT >= 2, "V_CHUNK_COUNT must be at least 2");
+
+    const static size_t DmaBytesPerPixelByte = (8 * T_MUXMAP::DmaBitsPerPixelBit * T_MUXMAP::MuxBusDataSize);
+    const static size_t ChunkSize = DmaBytesPerPixelByte * V_CHUNK_BYTES;
+
+    static_assert(ChunkSize < DMA_DESCRIPTOR_BUFFER_MAX_SIZE, "V_CHUNK_BYTES is too large for a DMA descriptor");
+
+    gdma_channel_handle_t _dmaChannel;
+    dma_descriptor_t* _dmaItems; // holds the ring of DMA descriptors, one per chunk
+    uint8_t* _chunks;            // holds the DMA chunk buffers that are referenced by _dmaItems
+    uint8_t* _source;            // holds a copy of the data for each mux bus, MuxMap.MaxBusDataSize each
+    size_t _sourceLaneCount;     // count of mux bus slots in _source
+    size_t _sourceSizes[T_MUXMAP::BusMaxCount]; // size of the data in each mux bus slot
+    size_t _chunkLast;           // index of the trailing all zero chunk that ends the frame
+    volatile size_t _chunksSent; // count of chunks the DMA has completed this frame
+    volatile uint32_t _underrunCount; // count of times the ISR was too late to encode a chunk
+    uint32_t _underrunLogged;    // _underrunCount when last logged
+
+public:
+    T_MUXMAP MuxMap;
+
+    // as a static instance, all members get initialized to zero
+    // and the constructor is called at inconsistent time to other globals
+    // so its not useful to have or rely on, 
+    // but without it presence they get zeroed far too late
+    NeoEspLcdStreamBuffContext()
+        //:
+    {
+    }
+
+    bool Construct(uint16_t nsBitSendTime)
+    {
+        // construct only once on first time called
+        if (_dmaItems == nullptr)
+        {
+            // a slot for every mux bus up to the highest registered one
+            _sourceLaneCount = 0;
+            for (size_t muxId = 0; muxId < T_MUXMAP::BusMaxCount; muxId++)
+            {
+                if (MuxMap.UpdateMapMask & (1 << muxId))
+                {
+                    _sourceLaneCount = muxId + 1;
+                }
+            }
+
+            // the last data chunk may be partial, followed by one all zero chunk 
+            // that gives the data time to leave the FIFO before the EOF ISR stops it
+            _chunkLast = (MuxMap.MaxBusDataSize + V_CHUNK_BYTES - 1) / V_CHUNK_BYTES;
+
+            size_t dmaBlockSize = V_CHUNK_COUNT * sizeof(dma_descriptor_t);
+            size_t sourceSize = _sourceLaneCount * MuxMap.MaxBusDataSize;
+
+            _dmaItems = static_cast<dma_descriptor_t*>(heap_caps_malloc(dmaBlockSize, MALLOC_CAP_DMA));
+            _chunks = static_cast<uint8_t*>(heap_caps_malloc(V_CHUNK_COUNT * ChunkSize, MALLOC_CAP_DMA));
+            // read from the ISR, so keep it out of PSRAM
+            _source = static_cast<uint8_t*>(heap_caps_malloc(sourceSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+            if (_dmaItems == nullptr || _chunks == nullptr || _source == nullptr)
+            {
+                log_e("LCD Stream memory allocation failure (size %u, %u, %u)",
+                    dmaBlockSize,
+                    V_CHUNK_COUNT * ChunkSize,
+                    sourceSize);
+                freeBuffers();
+                return false;
+            }
+            // required to init to zero as settings these below only resets some fields
+            memset(_dmaItems, 0x00, dmaBlockSize);
+            memset(_sourceSizes, 0x00, sizeof(_sourceSizes));
+
+            // init dma descriptor ring, every chunk is an EOF so the ISR 
+            // is called to encode it again once the DMA has read it
+            // 
+            for (size_t chunk = 0; chunk < V_CHUNK_COUNT; chunk++)
+            {
+                dma_descriptor_t* item = &_dmaItems[chunk];
+
+                item->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+                item->dw0.suc_eof = 1;
+                item->next = &_dmaItems[(chunk + 1) % V_CHUNK_COUNT];
+                item->dw0.size = ChunkSize;
+                item->dw0.length = ChunkSize;
+                item->buffer = _chunks + chunk * ChunkSize;
+            }
+
+            // Configure LCD Peripheral
+            // 
+            if (!NeoEspLcdConstructPeripheral(&_dmaChannel,
+                    nsBitSendTime,
+                    T_MUXMAP::DmaBitsPerPixelBit,
+                    T_MUXMAP::MuxBusDataSize,
+                    dmaStreamCallback,
+                    this))
+            {
+                Destruct();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Destruct()
+    {
+        if (_dmaItems == nullptr)
+        {
+            return;
+        }
+
+        periph_module_disable(PERIPH_LCD_CAM_MODULE);
+        periph_module_reset(PERIPH_LCD_CAM_MODULE);
+
+        gdma_reset(_dmaChannel);
+
+        freeBuffers();
+
+        MuxMap.Reset();
+    }
+
+    void StartWrite()
+    {
+        if (MuxMap.IsAllMuxBusesUpdated())
+        {
+            MuxMap.ResetMuxBusesUpdated();
+
+            if (_underrunCount != _underrunLogged)
+            {
+                log_w("LCD stream underrun, the ISR was too late %u times",
+                    _underrunCount - _underrunLogged);
+                _underrunLogged = _underrunCount;
+            }
+
+            // prime the whole ring, the ISR encodes the rest as they are sent
+            _chunksSent = 0;
+            for (size_t chunk = 0; chunk < V_CHUNK_COUNT; chunk++)
+            {
+                encodeChunk(chunk);
+            }
+            
+            gdma_reset(_dmaChannel);
+            LCD_CAM.lcd_user.lcd_dout = 1;
+            LCD_CAM.lcd_user.lcd_update = 1;
+            LCD_CAM.lcd_misc.lcd_afifo_reset = 1;
+
+            gdma_start(_dmaChannel, (intptr_t)&_dmaItems[0]);
+            esp_rom_delay_us(1);
+            LCD_CAM.lcd_user.lcd_start = 1; 
+        }
+    }
+
+    void FillBuffers(const uint8_t* data, 
+            size_t sizeData, 
+            uint8_t muxId)
+    {
+        // wait for not actively sending data
+        while (LCD_CAM.lcd_user.lcd_start)
+        {
+            yield();
+        }
+
+        // the data is only copied here and encoded while sending,
+        // past its size the mux bus is left low for the reset time
+        memcpy(_source + muxId * MuxMap.MaxBusDataSize, data, sizeData);
+        _sourceSizes[muxId] = sizeData;
+
+        MuxMap.MarkMuxBusUpdated(muxId);
+    }
+
+    // the count of times that the ISR was too late to encode a chunk before the
+    // DMA reached it, so it was sent with stale data; a larger V_CHUNK_COUNT
+    // gives the ISR more time
+    uint32_t UnderrunCount() const
+    {
+        return _underrunCount;
+    }
+
+private:
+    void freeBuffers()
+    {
+        heap_caps_free(_source);
+        heap_caps_free(_chunks);
+        heap_caps_free(_dmaItems);
+
+        _source = nullptr;
+        _chunks = nullptr;
+        _dmaItems = nullptr;
+        _sourceLaneCount = 0;
+    }
+
+    // encodes the given chunk of the frame into its slot in the ring,
+    // chunks past the end of the data are all zero
+    IRAM_ATTR void encodeChunk(size_t chunk)
+    {
+        uint8_t* dmaChunk = _chunks + (chunk % V_CHUNK_COUNT) * ChunkSize;
+        size_t offset = chunk * V_CHUNK_BYTES;
+
+        memset(dmaChunk, 0x00, ChunkSize);
+
+        for (size_t muxId = 0; muxId < _sourceLaneCount; muxId++)
+        {
+            if ((MuxMap.UpdateMapMask & (1 << muxId)) && offset < _sourceSizes[muxId])
+            {
+                size_t sizeData = _sourceSizes[muxId] - offset;
+                if (sizeData > V_CHUNK_BYTES)
+                {
+                    sizeData = V_CHUNK_BYTES;
+                }
+
+                MuxMap.EncodeIntoDma(dmaChunk,
+                    _source + muxId * MuxMap.MaxBusDataSize + offset,
+                    sizeData,
+                    muxId);
+            }
+        }
+    }
+
+    // called by the DMA EOF ISR as each chunk in the ring has been read
+    static IRAM_ATTR bool dmaStreamCallback(gdma_channel_handle_t dma_chan,
+            gdma_event_data_t* event_data,
+            void* user_data)
+    {
+        NeoEspLcdStreamBuffContext* context = static_cast<NeoEspLcdStreamBuffContext*>(user_data);
+        size_t chunk = context->_chunksSent;
+
+        if (chunk > context->_chunkLast)
+        {
+            // the frame is already complete, the DMA is just draining
+            return true;
+        }
+
+        // when the ISR is late the EOFs of several chunks get combined, the 
+        // descriptor address of the last one tells how many were read since
+        const dma_descriptor_t* itemDone = reinterpret_cast<const dma_descriptor_t*>(event_data->tx_eof_desc_addr);
+        size_t slotDone = itemDone - context->_dmaItems;
+        size_t behind = (slotDone + V_CHUNK_COUNT - (chunk % V_CHUNK_COUNT)) % V_CHUNK_COUNT;
+
+        if (behind >= V_CHUNK_COUNT - 1)
+        {
+            // the DMA has reached a slot that was not encoded yet
+            context->_underrunCount++;
+        }
+
+        for (size_t done = 0; done <= behind; done++)
+        {
+            if (chunk >= context->_chunkLast)
+            {
+                // the trailing zero chunk has been read, the frame is complete
+                LCD_CAM.lcd_user.lcd_start = 0;
+                chunk = context->_chunkLast + 1;
+                break;
+            }
+
+            // the DMA is done reading this chunk, reuse its slot for the
+            // chunk that follows the ones already queued in the ring
+            context->encodeChunk(chunk + V_CHUNK_COUNT);
+            chunk++;
+        }
+        context->_chunksSent = chunk;
+        return true;
+    }
+};
+
 //
 // Implementation of the low level interface into lcd mux bus
 // 
-// T_BUSCONTEXT - the context to use, currently only NeoEspLcdDblBuffContext but there is
-//      a plan to provide one that doesn't implement the front buffer but would be less
-//      async as it would have to wait until the last frame was completely sent before
-//      updating and new data
+// T_BUSCONTEXT - the context to use, NeoEspLcdMonoBuffContext that encodes the whole frame
+//      into DMA memory or NeoEspLcdStreamBuffContext that encodes it in small chunks while sending
 // T_BUS - the bus id, NeoEsp32LcdBusZero, NeoEsp32LcdBusOne
 //
 template<typename T_BUSCONTEXT> 
@@ -592,6 +895,12 @@ public:
         s_context.MuxMap.MarkMuxBusUpdated(_muxId);
     }
 
+    // only available with NeoEspLcdStreamBuffContext, see its UnderrunCount
+    static uint32_t UnderrunCount()
+    {
+        return s_context.UnderrunCount();
+    }
+
 private:
     static T_BUSCONTEXT s_context;
     uint8_t _muxId; 
@@ -649,7 +958,6 @@ public:
         if (_data == nullptr)
         {
             log_e("front buffer memory allocation failure");
-            _bus.Destruct()
             return false;
         }
         return true;
@@ -702,6 +1010,9 @@ private:
 typedef NeoEsp32LcdMuxBus<NeoEspLcdMonoBuffContext<NeoEspLcdMuxMap<uint8_t, NeoEspLcdMuxBusSize8Bit>>> NeoEsp32LcdMux8Bus;
 typedef NeoEsp32LcdMuxBus<NeoEspLcdMonoBuffContext<NeoEspLcdMuxMap<uint16_t, NeoEspLcdMuxBusSize16Bit>>> NeoEsp32LcdMux16Bus;
 
+typedef NeoEsp32LcdMuxBus<NeoEspLcdStreamBuffContext<NeoEspLcdMuxMap<uint8_t, NeoEspLcdMuxBusSize8Bit>>> NeoEsp32LcdMux8StreamBus;
+typedef NeoEsp32LcdMuxBus<NeoEspLcdStreamBuffContext<NeoEspLcdMuxMap<uint16_t, NeoEspLcdMuxBusSize16Bit>>> NeoEsp32LcdMux16StreamBus;
+
 
 //--------------------------------------------------------
 
@@ -779,4 +1090,82 @@ typedef NeoEsp32LcdX16Ws2812xInvertedMethod NeoEsp32LcdX16Ws2816InvertedMethod;
 typedef NeoEsp32LcdX16800KbpsInvertedMethod NeoEsp32LcdX16Ws2812InvertedMethod;
 typedef NeoEsp32LcdX16Sk6812InvertedMethod  NeoEsp32LcdX16Lc8812InvertedMethod;
 
+//--------------------------------------------------------
+// streaming versions, DMA memory is bounded by the chunk size rather than the strip length
+// they can not be mixed with the above as they share the LCD peripheral
+
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2812x, NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8Ws2812xStreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2805,   NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8Ws2805StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedSk6812,   NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8Sk6812StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1814,   NeoEsp32LcdMux8StreamBus, NeoBitsInverted> NeoEsp32LcdX8Tm1814StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1914,   NeoEsp32LcdMux8StreamBus, NeoBitsInverted> NeoEsp32LcdX8Tm1829StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1829,   NeoEsp32LcdMux8StreamBus, NeoBitsInverted> NeoEsp32LcdX8Tm1914StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed800Kbps,  NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8800KbpsStreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed400Kbps,  NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8400KbpsStreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedApa106,   NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8Apa106StreamMethod;
+
+typedef NeoEsp32LcdX8Ws2805StreamMethod NeoEsp32LcdX8Ws2814StreamMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamMethod NeoEsp32LcdX8Ws2813StreamMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamMethod NeoEsp32LcdX8Ws2812dStreamMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamMethod NeoEsp32LcdX8Ws2811StreamMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamMethod NeoEsp32LcdX8Ws2816StreamMethod;
+typedef NeoEsp32LcdX8800KbpsStreamMethod NeoEsp32LcdX8Ws2812StreamMethod;
+typedef NeoEsp32LcdX8Sk6812StreamMethod  NeoEsp32LcdX8Lc8812StreamMethod;
+
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2812x, NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16Ws2812xStreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2805,   NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16Ws2805StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedSk6812,   NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16Sk6812StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1814,   NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16Tm1814StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1914,   NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16Tm1829StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1829,   NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16Tm1914StreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed800Kbps,  NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16800KbpsStreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed400Kbps,  NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16400KbpsStreamMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedApa106,   NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16Apa106StreamMethod;
+
+typedef NeoEsp32LcdX16Ws2805StreamMethod NeoEsp32LcdX16Ws2814StreamMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamMethod NeoEsp32LcdX16Ws2813StreamMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamMethod NeoEsp32LcdX16Ws2812dStreamMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamMethod NeoEsp32LcdX16Ws2811StreamMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamMethod NeoEsp32LcdX16Ws2816StreamMethod;
+typedef NeoEsp32LcdX16800KbpsStreamMethod NeoEsp32LcdX16Ws2812StreamMethod;
+typedef NeoEsp32LcdX16Sk6812StreamMethod  NeoEsp32LcdX16Lc8812StreamMethod;
+
+
+//--------------------------------------------------------
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2812x, NeoEsp32LcdMux8StreamBus, NeoBitsInverted>    NeoEsp32LcdX8Ws2812xStreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2805,   NeoEsp32LcdMux8StreamBus, NeoBitsInverted>    NeoEsp32LcdX8Ws2805StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedSk6812,   NeoEsp32LcdMux8StreamBus, NeoBitsInverted>    NeoEsp32LcdX8Sk6812StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1814,   NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8Tm1814StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1914,   NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8Tm1829StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1829,   NeoEsp32LcdMux8StreamBus, NeoBitsNotInverted> NeoEsp32LcdX8Tm1914StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed800Kbps,  NeoEsp32LcdMux8StreamBus, NeoBitsInverted>    NeoEsp32LcdX8800KbpsStreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed400Kbps,  NeoEsp32LcdMux8StreamBus, NeoBitsInverted>    NeoEsp32LcdX8400KbpsStreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedApa106,   NeoEsp32LcdMux8StreamBus, NeoBitsInverted>    NeoEsp32LcdX8Apa106StreamInvertedMethod;
+
+typedef NeoEsp32LcdX8Ws2805StreamInvertedMethod  NeoEsp32LcdX8Ws2814StreamInvertedMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamInvertedMethod NeoEsp32LcdX8Ws2813StreamInvertedMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamInvertedMethod NeoEsp32LcdX8Ws2812dStreamInvertedMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamInvertedMethod NeoEsp32LcdX8Ws2811StreamInvertedMethod;
+typedef NeoEsp32LcdX8Ws2812xStreamInvertedMethod NeoEsp32LcdX8Ws2816StreamInvertedMethod;
+typedef NeoEsp32LcdX8800KbpsStreamInvertedMethod NeoEsp32LcdX8Ws2812StreamInvertedMethod;
+typedef NeoEsp32LcdX8Sk6812StreamInvertedMethod  NeoEsp32LcdX8Lc8812StreamInvertedMethod;
+
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2812x, NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16Ws2812xStreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedWs2805,   NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16Ws2805StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedSk6812,   NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16Sk6812StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1814,   NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16Tm1814StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1914,   NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16Tm1829StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedTm1829,   NeoEsp32LcdMux16StreamBus, NeoBitsNotInverted> NeoEsp32LcdX16Tm1914StreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed800Kbps,  NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16800KbpsStreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeed400Kbps,  NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16400KbpsStreamInvertedMethod;
+typedef NeoEsp32LcdXMethodBase<NeoBitsSpeedApa106,   NeoEsp32LcdMux16StreamBus, NeoBitsInverted> NeoEsp32LcdX16Apa106StreamInvertedMethod;
+
+typedef NeoEsp32LcdX16Ws2805StreamInvertedMethod  NeoEsp32LcdX16Ws2814StreamInvertedMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamInvertedMethod NeoEsp32LcdX16Ws2813StreamInvertedMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamInvertedMethod NeoEsp32LcdX16Ws2812dStreamInvertedMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamInvertedMethod NeoEsp32LcdX16Ws2811StreamInvertedMethod;
+typedef NeoEsp32LcdX16Ws2812xStreamInvertedMethod NeoEsp32LcdX16Ws2816StreamInvertedMethod;
+typedef NeoEsp32LcdX16800KbpsStreamInvertedMethod NeoEsp32LcdX16Ws2812StreamInvertedMethod;
+typedef NeoEsp32LcdX16Sk6812StreamInvertedMethod  NeoEsp32LcdX16Lc8812StreamInvertedMethod;
+
 #endif // defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_IDF_TARGET_ESP32S3)
@@ -0,0 +1,523 @@
+/*-------------------------------------------------------------------------
+NeoPointTopology maps pixels placed at arbitrary 2d or 3d points
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+//-----------------------------------------------------------------------------
+// class NeoPointTopology
+// Describes pixels placed at arbitrary points, like a sculpture, rather than
+// in rows, columns or rings; the pixel index is the order of the points.
+// The points are loaded from a PROGMEM table or a file of int16_t x, y (and
+// z for 3d) records, in any units within +-16383, and are sorted into a grid
+// of cells so Nearest and Within only look at the cells around the query.
+//
+// BuildSampleTable fits the x,y bounds of the points onto a 2d NeoBuffer and 
+// stores where each pixel samples it, so Render only blends the four buffer
+// pixels around each point, for drawing effects in 2d and showing them on
+// the irregular pixels.
+//-----------------------------------------------------------------------------
+class NeoPointTopology
+{
+public:
+    NeoPointTopology() :
+        _countPoints(0),
+        _x(nullptr),
+        _y(nullptr),
+        _z(nullptr),
+        _cellStart(nullptr),
+        _cellPoints(nullptr)
+    {
+    }
+
+    ~NeoPointTopology()
+    {
+        release();
+    }
+
+    // ------------------------------------------------------------------------
+    // LoadProgmem loads count points from a PROGMEM table of int16_t
+    // dimensions - 2 for x, y records, 3 for x, y, z records
+    // returns false for other dimensions or more than 65534 points
+    // ------------------------------------------------------------------------
+    bool LoadProgmem(PGM_VOID_P points, uint16_t count, uint8_t dimensions = 2)
+    {
+        const int16_t* pPoints = static_cast<const int16_t*>(points);
+
+        // 0xffff is PixelIndex_OutOfBounds
+        if (!isValidDimensions(dimensions) || count > 0xfffe || !allocate(count))
+        {
+            return false;
+        }
+
+        for (uint16_t point = 0; point < count; point++)
+        {
+            _x[point] = pgm_read_word(pPoints++);
+            _y[point] = pgm_read_word(pPoints++);
+            _z[point] = (dimensions > 2) ? pgm_read_word(pPoints++) : 0;
+        }
+        return buildIndex();
+    }
+
+    // ------------------------------------------------------------------------
+    // LoadFile loads all the points of a file of little endian int16_t 
+    // records, T_FILE_METHOD is any standard Arduino File
+    // dimensions - 2 for x, y records, 3 for x, y, z records
+    // ------------------------------------------------------------------------
+    template <typename T_FILE_METHOD> bool LoadFile(T_FILE_METHOD& file, uint8_t dimensions = 2)
+    {
+        if (!isValidDimensions(dimensions))
+        {
+            return false;
+        }
+
+        size_t sizeRecord = dimensions * sizeof(int16_t);
+        size_t count = file.size() / sizeRecord;
+
+        if (count > 0xfffe || !allocate(count))
+        {
+            return false;
+        }
+
+        for (uint16_t point = 0; point < count; point++)
+        {
+            uint8_t record[3 * sizeof(int16_t)];
+
+            if (static_cast<size_t>(file.read(record, sizeRecord)) != sizeRecord)
+            {
+                release();
+                return false;
+            }
+            _x[point] = record[0] | (record[1] << 8);
+            _y[point] = record[2] | (record[3] << 8);
+            _z[point] = (dimensions > 2) ? (record[4] | (record[5] << 8)) : 0;
+        }
+        return buildIndex();
+    }
+
+    uint16_t PointCount() const
+    {
+        return _countPoints;
+    }
+
+    bool GetPoint(uint16_t indexPixel, int16_t* x, int16_t* y, int16_t* z = nullptr) const
+    {
+        if (indexPixel >= _countPoints)
+        {
+            return false;
+        }
+        *x = _x[indexPixel];
+        *y = _y[indexPixel];
+        if (z)
+        {
+            *z = _z[indexPixel];
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // Nearest returns the index of the pixel closest to the point, or
+    // PixelIndex_OutOfBounds if there are no points
+    // ------------------------------------------------------------------------
+    uint16_t Nearest(int16_t x, int16_t y, int16_t z = 0) const
+    {
+        uint16_t best = PixelIndex_OutOfBounds;
+        uint32_t bestDistance = 0xffffffff;
+
+        if (_countPoints == 0)
+        {
+            return best;
+        }
+
+        int16_t cx = cellOf(x, _minX, _cellsX);
+        int16_t cy = cellOf(y, _minY, _cellsY);
+        int16_t cz = cellOf(z, _minZ, _cellsZ);
+        int16_t maxRing = _cellsX;
+
+        if (_cellsY > maxRing)
+        {
+            maxRing = _cellsY;
+        }
+        if (_cellsZ > maxRing)
+        {
+            maxRing = _cellsZ;
+        }
+
+        for (int16_t ring = 0; ring < maxRing; ring++)
+        {
+            // the cells of each ring surround the ones before with a ring of
+            // cells between, so once the best is nearer than this ring can
+            // be, no later one is nearer
+            uint32_t ringDistance = static_cast<uint32_t>(ring - 1) * _cellSize;
+
+            if (ring && best != PixelIndex_OutOfBounds && bestDistance <= ringDistance * ringDistance)
+            {
+                break;
+            }
+
+            // only the part of the ring that is within the grid
+            int16_t x0 = (cx - ring > 0) ? cx - ring : 0;
+            int16_t x1 = (cx + ring < _cellsX) ? cx + ring : _cellsX - 1;
+            int16_t y0 = (cy - ring > 0) ? cy - ring : 0;
+            int16_t y1 = (cy + ring < _cellsY) ? cy + ring : _cellsY - 1;
+            int16_t z0 = (cz - ring > 0) ? cz - ring : 0;
+            int16_t z1 = (cz + ring < _cellsZ) ? cz + ring : _cellsZ - 1;
+
+            for (int16_t iz = z0; iz <= z1; iz++)
+            {
+                for (int16_t iy = y0; iy <= y1; iy++)
+                {
+                    for (int16_t ix = x0; ix <= x1; ix++)
+                    {
+                        // only the shell of the ring is new
+                        if (ix != cx - ring && ix != cx + ring &&
+                            iy != cy - ring && iy != cy + ring &&
+                            iz != cz - ring && iz != cz + ring)
+                        {
+                            continue;
+                        }
+
+                        uint32_t cell = cellIndex(ix, iy, iz);
+
+                        for (uint16_t entry = _cellStart[cell]; entry < _cellStart[cell + 1]; entry++)
+                        {
+                            uint16_t point = _cellPoints[entry];
+                            uint32_t distance = distanceSquared(point, x, y, z);
+
+                            if (distance < bestDistance)
+                            {
+                                bestDistance = distance;
+                                best = point;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return best;
+    }
+
+    // ------------------------------------------------------------------------
+    // Within stores the indexes of the pixels within radius of the point
+    // into results, up to countMax, and returns how many were stored
+    // ------------------------------------------------------------------------
+    uint16_t Within(int16_t x,
+        int16_t y,
+        int16_t z,
+        uint16_t radius,
+        uint16_t* results,
+        uint16_t countMax) const
+    {
+        uint16_t count = 0;
+
+        if (_countPoints == 0)
+        {
+            return 0;
+        }
+
+        uint32_t radiusSquared = static_cast<uint32_t>(radius) * radius;
+        int16_t x0 = cellOf(static_cast<int32_t>(x) - radius, _minX, _cellsX);
+        int16_t x1 = cellOf(static_cast<int32_t>(x) + radius, _minX, _cellsX);
+        int16_t y0 = cellOf(static_cast<int32_t>(y) - radius, _minY, _cellsY);
+        int16_t y1 = cellOf(static_cast<int32_t>(y) + radius, _minY, _cellsY);
+        int16_t z0 = cellOf(static_cast<int32_t>(z) - radius, _minZ, _cellsZ);
+        int16_t z1 = cellOf(static_cast<int32_t>(z) + radius, _minZ, _cellsZ);
+
+        for (int16_t iz = z0; iz <= z1; iz++)
+        {
+            for (int16_t iy = y0; iy <= y1; iy++)
+            {
+                for (int16_t ix = x0; ix <= x1; ix++)
+                {
+                    uint32_t cell = cellIndex(ix, iy, iz);
+
+                    for (uint16_t entry = _cellStart[cell]; entry < _cellStart[cell + 1]; entry++)
+                    {
+                        uint16_t point = _cellPoints[entry];
+
+                        if (distanceSquared(point, x, y, z) <= radiusSquared)
+                        {
+                            if (count >= countMax)
+                            {
+                                return count;
+                            }
+                            results[count++] = point;
+                        }
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    // ------------------------------------------------------------------------
+    // BuildSampleTable fits the x,y bounds of the points to a buffer of 
+    // width by height and stores where each pixel samples it
+    // ------------------------------------------------------------------------
+    bool BuildSampleTable(uint16_t width, uint16_t height)
+    {
+        if (!_sampleTable.Allocate(_countPoints, width, height))
+        {
+            return false;
+        }
+
+        for (uint16_t point = 0; point < _countPoints; point++)
+        {
+            // 8.8 fixed point buffer position, pixel centers at the bounds
+            uint32_t u = fitToBuffer(_x[point], _minX, _maxX, width);
+            uint32_t v = fitToBuffer(_y[point], _minY, _maxY, height);
+
+            _sampleTable.SetSample(point, u, v);
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // Render samples source onto the pixels of destBuffer, after 
+    // BuildSampleTable with the size of source
+    // ------------------------------------------------------------------------
+    template <typename T_BUFFER_METHOD> void Render(
+        NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        NeoBuffer<T_BUFFER_METHOD>& source)
+    {
+        _sampleTable.Render(destBuffer, source);
+    }
+
+private:
+    uint16_t _countPoints;
+    int16_t* _x;
+    int16_t* _y;
+    int16_t* _z;
+
+    // bounds and grid
+    int16_t _minX;
+    int16_t _maxX;
+    int16_t _minY;
+    int16_t _maxY;
+    int16_t _minZ;
+    int16_t _maxZ;
+    uint16_t _cellSize;
+    int16_t _cellsX;
+    int16_t _cellsY;
+    int16_t _cellsZ;
+    uint16_t* _cellStart; // first entry of each cell in _cellPoints, and the end
+    uint16_t* _cellPoints; // point indexes sorted by cell
+
+    NeoSampleTable _sampleTable;
+
+    bool allocate(size_t count)
+    {
+        release();
+
+        _x = new int16_t[count];
+        _y = new int16_t[count];
+        _z = new int16_t[count];
+        _cellPoints = new uint16_t[count];
+        if (_x == nullptr || _y == nullptr || _z == nullptr || _cellPoints == nullptr)
+        {
+            release();
+            return false;
+        }
+        _countPoints = count;
+        return true;
+    }
+
+    void release()
+    {
+        delete[] _x;
+        delete[] _y;
+        delete[] _z;
+        delete[] _cellStart;
+        delete[] _cellPoints;
+        _sampleTable.Release();
+
+        _x = nullptr;
+        _y = nullptr;
+        _z = nullptr;
+        _cellStart = nullptr;
+        _cellPoints = nullptr;
+        _countPoints = 0;
+    }
+
+    bool buildIndex()
+    {
+        if (_countPoints == 0)
+        {
+            return true;
+        }
+
+        _minX = _maxX = _x[0];
+        _minY = _maxY = _y[0];
+        _minZ = _maxZ = _z[0];
+
+        for (uint16_t point = 1; point < _countPoints; point++)
+        {
+            expand(_x[point], &_minX, &_maxX);
+            expand(_y[point], &_minY, &_maxY);
+            expand(_z[point], &_minZ, &_maxZ);
+        }
+
+        // cells sized for about two points each, using only the axes that
+        // are wider than a cell so nearly flat or thin sets of points don't
+        // spread the cells along an axis they barely use
+        float ranges[3] = { _maxX - _minX + 1.0f, _maxY - _minY + 1.0f, _maxZ - _minZ + 1.0f };
+        float cellSize = 1.0f;
+
+        for (uint8_t pass = 0; pass < 3; pass++)
+        {
+            float cellVolume = 2.0f / _countPoints;
+            uint8_t dimensions = 0;
+
+            for (uint8_t axis = 0; axis < 3; axis++)
+            {
+                if (ranges[axis] > cellSize)
+                {
+                    cellVolume *= ranges[axis];
+                    dimensions++;
+                }
+            }
+
+            if (dimensions == 3)
+            {
+                cellSize = cbrtf(cellVolume);
+            }
+            else if (dimensions == 2)
+            {
+                cellSize = sqrtf(cellVolume);
+            }
+            else if (dimensions == 1)
+            {
+                cellSize = cellVolume;
+            }
+        }
+        _cellSize = (cellSize < 65534.0f) ? static_cast<uint16_t>(cellSize + 1.0f) : 0xffff;
+
+        // the rounding up of each axis can still leave more cells than
+        // points, so grow the cells until there are no more than that
+        uint32_t countCells;
+
+        for (;;)
+        {
+            _cellsX = (static_cast<int32_t>(_maxX) - _minX) / _cellSize + 1;
+            _cellsY = (static_cast<int32_t>(_maxY) - _minY) / _cellSize + 1;
+            _cellsZ = (static_cast<int32_t>(_maxZ) - _minZ) / _cellSize + 1;
+            countCells = static_cast<uint32_t>(_cellsX) * _cellsY * _cellsZ;
+
+            if (countCells <= _countPoints || _cellSize > 0xffff - (_cellSize / 4 + 1))
+            {
+                break;
+            }
+            _cellSize += _cellSize / 4 + 1;
+        }
+
+        // counting sort of the points into the cells
+        _cellStart = new uint16_t[countCells + 1];
+        if (_cellStart == nullptr)
+        {
+            release();
+            return false;
+        }
+        memset(_cellStart, 0, (countCells + 1) * sizeof(uint16_t));
+
+        for (uint16_t point = 0; point < _countPoints; point++)
+        {
+            _cellStart[cellOfPoint(point) + 1]++;
+        }
+        for (uint32_t cell = 0; cell < countCells; cell++)
+        {
+            _cellStart[cell + 1] += _cellStart[cell];
+        }
+        for (uint16_t point = 0; point < _countPoints; point++)
+        {
+            // uses the start of the next cell as the fill position
+            _cellPoints[_cellStart[cellOfPoint(point)]++] = point;
+        }
+        for (uint32_t cell = countCells; cell > 0; cell--)
+        {
+            _cellStart[cell] = _cellStart[cell - 1];
+        }
+        _cellStart[0] = 0;
+        return true;
+    }
+
+    static bool isValidDimensions(uint8_t dimensions)
+    {
+        return (dimensions == 2 || dimensions == 3);
+    }
+
+    static void expand(int16_t value, int16_t* pMin, int16_t* pMax)
+    {
+        if (value < *pMin)
+        {
+            *pMin = value;
+        }
+        else if (value > *pMax)
+        {
+            *pMax = value;
+        }
+    }
+
+    // the cell along one axis, clamped into the grid
+    int16_t cellOf(int32_t value, int16_t minValue, int16_t countCells) const
+    {
+        int32_t cell = (value - minValue) / static_cast<int32_t>(_cellSize);
+
+        if (value < minValue)
+        {
+            return 0;
+        }
+        return (cell < countCells) ? cell : countCells - 1;
+    }
+
+    uint32_t cellOfPoint(uint16_t point) const
+    {
+        return cellIndex(cellOf(_x[point], _minX, _cellsX),
+            cellOf(_y[point], _minY, _cellsY),
+            cellOf(_z[point], _minZ, _cellsZ));
+    }
+
+    // the cell must be within the grid
+    uint32_t cellIndex(int16_t ix, int16_t iy, int16_t iz) const
+    {
+        return (static_cast<uint32_t>(iz) * _cellsY + iy) * _cellsX + ix;
+    }
+
+    uint32_t distanceSquared(uint16_t point, int16_t x, int16_t y, int16_t z) const
+    {
+        int32_t dx = _x[point] - x;
+        int32_t dy = _y[point] - y;
+        int32_t dz = _z[point] - z;
+
+        return static_cast<uint32_t>(dx * dx) + static_cast<uint32_t>(dy * dy) + static_cast<uint32_t>(dz * dz);
+    }
+
+    static uint32_t fitToBuffer(int16_t value, int16_t minValue, int16_t maxValue, uint16_t size)
+    {
+        if (maxValue == minValue || size < 2)
+        {
+            return 0;
+        }
+        return (static_cast<uint64_t>(value - minValue) * (size - 1) * 256) / (maxValue - minValue);
+    }
+};
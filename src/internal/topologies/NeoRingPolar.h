@@ -0,0 +1,281 @@
+/*-------------------------------------------------------------------------
+NeoRingPolar maps polar coordinates onto the pixels of a NeoRingTopology
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+enum NeoRingGradient
+{
+    NeoRingGradient_Radial,  // the gradient runs from the center ring out
+    NeoRingGradient_Angular  // the gradient runs around each ring
+};
+
+// NeoRingPolar - 
+// Precomputes the angle of every pixel and the radius of every ring of a
+// NeoRingTopology so radial effects can work in polar coordinates without
+// any trig per pixel.
+// Angles are 0 to 65535 for a full turn and follow the pixel order of the 
+// rings; radii are 0 at the center to 65535 at the outer ring.
+// 
+// ringRadii - optional, the radius of each ring in any units from the center
+//     out, like millimeters; by default the rings are evenly spaced 
+// ringAngles - optional, the angle of the first pixel of each ring, for 
+//     rings that are not wired starting at the same angle; by default 0
+//
+template <typename T_RING_TOPOLOGY> class NeoRingPolar
+{
+public:
+    NeoRingPolar(const T_RING_TOPOLOGY& topology,
+        const uint16_t* ringRadii = nullptr,
+        const uint16_t* ringAngles = nullptr) :
+        _countRings(topology.getCountOfRings()),
+        _countPixels(topology.getPixelCount())
+    {
+        _ringStart = new uint16_t[_countRings + 1];
+        _ringRadius = new uint16_t[_countRings];
+        _pixelAngle = new uint16_t[_countPixels];
+
+        uint16_t radiusMax = (ringRadii != nullptr) ? ringRadii[_countRings - 1] : 0;
+
+        for (uint8_t ring = 0; ring < _countRings; ring++)
+        {
+            uint16_t start = topology.Map(ring, 0);
+            uint16_t count = topology.getPixelCountAtRing(ring);
+            uint16_t angleFirst = (ringAngles != nullptr) ? ringAngles[ring] : 0;
+
+            _ringStart[ring] = start;
+            if (ringRadii != nullptr)
+            {
+                _ringRadius[ring] = radiusMax ? 
+                    (static_cast<uint32_t>(ringRadii[ring]) * 65535) / radiusMax : 
+                    0;
+            }
+            else
+            {
+                _ringRadius[ring] = (_countRings > 1) ? 
+                    (static_cast<uint32_t>(ring) * 65535) / (_countRings - 1) : 
+                    0;
+            }
+
+            for (uint16_t pixel = 0; pixel < count; pixel++)
+            {
+                _pixelAngle[start + pixel] = angleFirst + (static_cast<uint32_t>(pixel) << 16) / count;
+            }
+        }
+        _ringStart[_countRings] = _countPixels;
+    }
+
+    ~NeoRingPolar()
+    {
+        delete[] _ringStart;
+        delete[] _ringRadius;
+        delete[] _pixelAngle;
+    }
+
+    uint16_t GetAngle(uint16_t indexPixel) const
+    {
+        return (indexPixel < _countPixels) ? _pixelAngle[indexPixel] : 0;
+    }
+
+    uint16_t GetRadius(uint8_t ring) const
+    {
+        return (ring < _countRings) ? _ringRadius[ring] : 0;
+    }
+
+    // ------------------------------------------------------------------------
+    // MapPolar returns the pixel nearest to the angle on the ring nearest to
+    // the radius
+    // ------------------------------------------------------------------------
+    uint16_t MapPolar(uint16_t angle, uint16_t radius) const
+    {
+        uint8_t ring = 0;
+        uint16_t bestDelta = 0xffff;
+
+        for (uint8_t iRing = 0; iRing < _countRings; iRing++)
+        {
+            uint16_t delta = (radius > _ringRadius[iRing]) ? 
+                radius - _ringRadius[iRing] :
+                _ringRadius[iRing] - radius;
+
+            if (delta < bestDelta)
+            {
+                bestDelta = delta;
+                ring = iRing;
+            }
+        }
+
+        uint16_t start = _ringStart[ring];
+        uint16_t count = _ringStart[ring + 1] - start;
+        uint16_t turn = angle - _pixelAngle[start];
+        uint16_t pixel = (static_cast<uint32_t>(turn) * count + 0x8000) >> 16;
+
+        return start + ((pixel < count) ? pixel : 0);
+    }
+
+    // ------------------------------------------------------------------------
+    // BuildSampleTable places the rings centered on a buffer of width by 
+    // height, the outer ring touching its nearest edges, angle 0 to the 
+    // right and turning clockwise, and stores where each pixel samples it
+    // ------------------------------------------------------------------------
+    bool BuildSampleTable(uint16_t width, uint16_t height)
+    {
+        if (!_sampleTable.Allocate(_countPixels, width, height))
+        {
+            return false;
+        }
+
+        float diameter = ((width < height) ? width : height) - 1.0f;
+        float centerX = (width - 1.0f) / 2.0f;
+        float centerY = (height - 1.0f) / 2.0f;
+        float scale = diameter / 2.0f / 65535.0f;
+
+        for (uint8_t ring = 0; ring < _countRings; ring++)
+        {
+            float radius = _ringRadius[ring] * scale;
+
+            for (uint16_t indexPixel = _ringStart[ring]; indexPixel < _ringStart[ring + 1]; indexPixel++)
+            {
+                float angle = _pixelAngle[indexPixel] * (TWO_PI / 65536.0f);
+                // 8.8 fixed point, clamped inside for rounding at the edges
+                int32_t u = static_cast<int32_t>((centerX + cosf(angle) * radius) * 256.0f + 0.5f);
+                int32_t v = static_cast<int32_t>((centerY + sinf(angle) * radius) * 256.0f + 0.5f);
+
+                u = (u < 0) ? 0 : ((u > (width - 1) * 256) ? (width - 1) * 256 : u);
+                v = (v < 0) ? 0 : ((v > (height - 1) * 256) ? (height - 1) * 256 : v);
+                _sampleTable.SetSample(indexPixel, u, v);
+            }
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // Render samples source onto all the rings of destBuffer in one pass,
+    // after BuildSampleTable with the size of source
+    // ------------------------------------------------------------------------
+    template <typename T_BUFFER_METHOD> void Render(
+        NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        NeoBuffer<T_BUFFER_METHOD>& source)
+    {
+        _sampleTable.Render(destBuffer, source);
+    }
+
+    // ------------------------------------------------------------------------
+    // RenderGradient draws the first row of gradient onto all the rings,
+    // from the center out or around each ring, blending between its pixels;
+    // an angular gradient wraps from its last pixel back to the first
+    // rotate - turns an angular gradient, 65536 being a full turn
+    // ------------------------------------------------------------------------
+    template <typename T_BUFFER_METHOD> void RenderGradient(
+        NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        NeoBuffer<T_BUFFER_METHOD>& gradient,
+        NeoRingGradient kind = NeoRingGradient_Radial,
+        uint16_t rotate = 0)
+    {
+        typedef typename T_BUFFER_METHOD::ColorFeature Feature;
+        typedef typename T_BUFFER_METHOD::ColorObject ColorObject;
+
+        NeoBufferContext<Feature> gradientBuffer = gradient;
+        uint16_t width = gradient.Width();
+
+        if (width == 0)
+        {
+            return;
+        }
+
+        for (uint8_t ring = 0; ring < _countRings; ring++)
+        {
+            uint16_t first = _ringStart[ring];
+            uint16_t last = _ringStart[ring + 1];
+
+            if (last > destBuffer.PixelCount())
+            {
+                last = destBuffer.PixelCount();
+            }
+
+            if (kind == NeoRingGradient_Radial)
+            {
+                // the whole ring is one color
+                uint32_t position = (static_cast<uint32_t>(_ringRadius[ring]) * (width - 1)) >> 8;
+                ColorObject color = sampleGradient<Feature>(gradientBuffer.Pixels, width, position, false);
+
+                for (uint16_t indexPixel = first; indexPixel < last; indexPixel++)
+                {
+                    Feature::applyPixelColor(destBuffer.Pixels, indexPixel, color);
+                }
+            }
+            else
+            {
+                for (uint16_t indexPixel = first; indexPixel < last; indexPixel++)
+                {
+                    uint16_t angle = _pixelAngle[indexPixel] + rotate;
+                    uint32_t position = (static_cast<uint32_t>(angle) * width) >> 8;
+
+                    Feature::applyPixelColor(destBuffer.Pixels,
+                        indexPixel,
+                        sampleGradient<Feature>(gradientBuffer.Pixels, width, position, true));
+                }
+            }
+        }
+    }
+
+private:
+    const uint8_t _countRings;
+    const uint16_t _countPixels;
+    uint16_t* _ringStart;
+    uint16_t* _ringRadius;
+    uint16_t* _pixelAngle;
+
+    NeoSampleTable _sampleTable;
+
+    // position is 8.8 fixed point pixels along the gradient
+    template <typename T_FEATURE> static typename T_FEATURE::ColorObject sampleGradient(
+        const uint8_t* pixels,
+        uint16_t width,
+        uint32_t position,
+        bool wrap)
+    {
+        uint16_t index = position >> 8;
+        uint8_t fraction = position & 0xff;
+        uint16_t next = index + 1;
+
+        if (index >= width)
+        {
+            index = width - 1;
+        }
+        if (next >= width)
+        {
+            next = wrap ? 0 : width - 1;
+        }
+
+        typename T_FEATURE::ColorObject color = T_FEATURE::retrievePixelColor(pixels, index);
+
+        if (fraction == 0)
+        {
+            return color;
+        }
+        return T_FEATURE::ColorObject::LinearBlend(color,
+            T_FEATURE::retrievePixelColor(pixels, next),
+            NeoProgress16(fraction * 257));
+    }
+};
@@ -0,0 +1,155 @@
+/*-------------------------------------------------------------------------
+NeoSampleTable stores where each pixel samples a 2d NeoBuffer and renders it
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+//-----------------------------------------------------------------------------
+// class NeoSampleTable
+// Stores, for each pixel of a topology, where it samples a 2d NeoBuffer of 
+// width by height, so Render only blends the four buffer pixels around each
+// sample without any position math per frame.
+// It is used by the topologies that place their pixels onto a buffer, like
+// NeoPointTopology and NeoRingPolar, which compute the positions and call
+// SetSample once for each pixel.
+//-----------------------------------------------------------------------------
+class NeoSampleTable
+{
+public:
+    NeoSampleTable() :
+        _samples(nullptr),
+        _countSamples(0),
+        _width(0),
+        _height(0)
+    {
+    }
+
+    ~NeoSampleTable()
+    {
+        delete[] _samples;
+    }
+
+    // ------------------------------------------------------------------------
+    // Allocate makes room for count samples of a buffer of width by height,
+    // releasing any previous samples
+    // ------------------------------------------------------------------------
+    bool Allocate(uint16_t count, uint16_t width, uint16_t height)
+    {
+        Release();
+
+        _samples = new Sample[count];
+        if (_samples == nullptr)
+        {
+            return false;
+        }
+        _countSamples = count;
+        _width = width;
+        _height = height;
+        return true;
+    }
+
+    void Release()
+    {
+        delete[] _samples;
+
+        _samples = nullptr;
+        _countSamples = 0;
+    }
+
+    // ------------------------------------------------------------------------
+    // SetSample stores where the pixel samples the buffer
+    // u, v - 8.8 fixed point buffer position, within (width - 1) * 256 and 
+    //     (height - 1) * 256
+    // ------------------------------------------------------------------------
+    void SetSample(uint16_t indexPixel, uint32_t u, uint32_t v)
+    {
+        uint16_t sx = u >> 8;
+        uint16_t sy = v >> 8;
+        Sample& sample = _samples[indexPixel];
+
+        sample.Index = sy * _width + sx;
+        sample.FractionX = (sx + 1 < _width) ? (u & 0xff) : 0;
+        sample.FractionY = (sy + 1 < _height) ? (v & 0xff) : 0;
+    }
+
+    // ------------------------------------------------------------------------
+    // Render samples source onto the pixels of destBuffer, source must be
+    // the size given to Allocate
+    // ------------------------------------------------------------------------
+    template <typename T_BUFFER_METHOD> void Render(
+        NeoBufferContext<typename T_BUFFER_METHOD::ColorFeature> destBuffer,
+        NeoBuffer<T_BUFFER_METHOD>& source) const
+    {
+        typedef typename T_BUFFER_METHOD::ColorFeature Feature;
+        typedef typename T_BUFFER_METHOD::ColorObject ColorObject;
+
+        if (_samples == nullptr || source.Width() != _width || source.Height() != _height)
+        {
+            return;
+        }
+
+        NeoBufferContext<Feature> sourceBuffer = source;
+        uint16_t countPixels = destBuffer.PixelCount();
+
+        if (countPixels > _countSamples)
+        {
+            countPixels = _countSamples;
+        }
+
+        for (uint16_t indexPixel = 0; indexPixel < countPixels; indexPixel++)
+        {
+            const Sample& sample = _samples[indexPixel];
+            ColorObject color = Feature::retrievePixelColor(sourceBuffer.Pixels, sample.Index);
+
+            if (sample.FractionX || sample.FractionY)
+            {
+                // a zero fraction never weights the pixel past the edge 
+                uint16_t right = sample.Index + (sample.FractionX ? 1 : 0);
+                uint16_t below = sample.FractionY ? _width : 0;
+
+                // BilinearBlend x weight applies to c10 and y weight to c01 
+                color = ColorObject::BilinearBlend(color,
+                    Feature::retrievePixelColor(sourceBuffer.Pixels, sample.Index + below),
+                    Feature::retrievePixelColor(sourceBuffer.Pixels, right),
+                    Feature::retrievePixelColor(sourceBuffer.Pixels, right + below),
+                    NeoProgress16(sample.FractionX * 257),
+                    NeoProgress16(sample.FractionY * 257));
+            }
+            Feature::applyPixelColor(destBuffer.Pixels, indexPixel, color);
+        }
+    }
+
+private:
+    struct Sample
+    {
+        uint16_t Index; // the upper left buffer pixel
+        uint8_t FractionX;
+        uint8_t FractionY;
+    };
+
+    Sample* _samples;
+    uint16_t _countSamples;
+    uint16_t _width;
+    uint16_t _height;
+};
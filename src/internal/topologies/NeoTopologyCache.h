@@ -0,0 +1,200 @@
+/*-------------------------------------------------------------------------
+NeoTopologyCache precomputes the index tables of a topology
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+//-----------------------------------------------------------------------------
+// class NeoTopologyCache
+// Precomputes the x,y to index map of another topology once, so Map and 
+// MapProbe don't repeat the layout math, and the divisions of NeoTiles and
+// NeoMosaic, for every pixel.
+// When every row of the topology is a straight run (the indexes along it
+// change by the same step) only the start and step of each row are stored;
+// otherwise the full table. A single NeoTopology panel is stored as runs
+// with any non alternating layout, and with the alternating layouts whose
+// serpentine turns at the ends of the x rows, RowMajorAlternating, 
+// RowMajorAlternating180, ColumnMajorAlternating90 and 
+// ColumnMajorAlternating270; the other alternating layouts use the table.
+// The inverse, index to x,y, is also kept so effects that work in strip
+// order can get the position of each pixel with Unmap.
+// T_TOPOLOGY = NeoTopology, NeoTiles or NeoMosaic
+//-----------------------------------------------------------------------------
+template <typename T_TOPOLOGY> class NeoTopologyCache
+{
+public:
+    NeoTopologyCache(const T_TOPOLOGY& topology, bool withInverse = true) :
+        _width(topology.getWidth()),
+        _height(topology.getHeight()),
+        _indexes(nullptr),
+        _rowStart(nullptr),
+        _rowStep(nullptr),
+        _inverse(nullptr)
+    {
+        if (isRowRuns(topology))
+        {
+            _rowStart = new uint16_t[_height];
+            _rowStep = new int16_t[_height];
+
+            for (uint16_t y = 0; y < _height; y++)
+            {
+                _rowStart[y] = topology.Map(0, y);
+                _rowStep[y] = (_width > 1) ? topology.Map(1, y) - _rowStart[y] : 1;
+            }
+        }
+        else
+        {
+            _indexes = new uint16_t[_width * _height];
+
+            for (uint16_t y = 0; y < _height; y++)
+            {
+                for (uint16_t x = 0; x < _width; x++)
+                {
+                    _indexes[y * _width + x] = topology.Map(x, y);
+                }
+            }
+        }
+
+        if (withInverse)
+        {
+            // x, y pairs
+            _inverse = new uint16_t[_width * _height * 2];
+
+            for (uint16_t y = 0; y < _height; y++)
+            {
+                for (uint16_t x = 0; x < _width; x++)
+                {
+                    uint16_t indexPixel = MapProbe(x, y);
+
+                    _inverse[indexPixel * 2] = x;
+                    _inverse[indexPixel * 2 + 1] = y;
+                }
+            }
+        }
+    }
+
+    ~NeoTopologyCache()
+    {
+        delete[] _indexes;
+        delete[] _rowStart;
+        delete[] _rowStep;
+        delete[] _inverse;
+    }
+
+    uint16_t Map(int16_t x, int16_t y) const
+    {
+        if (x >= static_cast<int16_t>(_width))
+        {
+            x = _width - 1;
+        }
+        else if (x < 0)
+        {
+            x = 0;
+        }
+        if (y >= static_cast<int16_t>(_height))
+        {
+            y = _height - 1;
+        }
+        else if (y < 0)
+        {
+            y = 0;
+        }
+        return lookup(x, y);
+    }
+
+    uint16_t MapProbe(int16_t x, int16_t y) const
+    {
+        if (x < 0 || x >= _width || y < 0 || y >= _height)
+        {
+            return _width * _height; // count, out of bounds
+        }
+        return lookup(x, y);
+    }
+
+    // ------------------------------------------------------------------------
+    // Unmap returns the x,y of a pixel index, false if the index is out of
+    // bounds or the cache was made without the inverse
+    // ------------------------------------------------------------------------
+    bool Unmap(uint16_t indexPixel, int16_t* x, int16_t* y) const
+    {
+        if (_inverse == nullptr || indexPixel >= _width * _height)
+        {
+            return false;
+        }
+        *x = _inverse[indexPixel * 2];
+        *y = _inverse[indexPixel * 2 + 1];
+        return true;
+    }
+
+    // true when only the row starts and steps are stored
+    bool IsRowRuns() const
+    {
+        return (_indexes == nullptr);
+    }
+
+    uint16_t getWidth() const
+    {
+        return _width;
+    }
+
+    uint16_t getHeight() const
+    {
+        return _height;
+    }
+
+private:
+    const uint16_t _width;
+    const uint16_t _height;
+    uint16_t* _indexes;
+    uint16_t* _rowStart;
+    int16_t* _rowStep;
+    uint16_t* _inverse;
+
+    uint16_t lookup(uint16_t x, uint16_t y) const
+    {
+        if (_indexes)
+        {
+            return _indexes[y * _width + x];
+        }
+        return _rowStart[y] + _rowStep[y] * x;
+    }
+
+    bool isRowRuns(const T_TOPOLOGY& topology) const
+    {
+        for (uint16_t y = 0; y < _height; y++)
+        {
+            int32_t start = topology.Map(0, y);
+            int32_t step = (_width > 1) ? topology.Map(1, y) - start : 1;
+
+            for (uint16_t x = 2; x < _width; x++)
+            {
+                if (topology.Map(x, y) != start + step * x)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};